@@ -0,0 +1,47 @@
+#ifndef BENCHMARK_ALLOCATION_COUNTER_HPP
+#define BENCHMARK_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+#include <cstdlib>
+
+#include "benchmark/benchmark.h"
+
+// Counts heap allocations by interposing malloc.  Replacing operator new is
+// not enough: std::allocator calls malloc directly in this libc++, so the
+// storage of strings, functions and containers never reaches operator new.
+// The header defines malloc, so include it from one translation unit only.
+// Where malloc cannot be interposed no "Allocs" counter is reported.
+#if defined(__GLIBC__)
+#define BENCHMARK_HAS_ALLOCATION_COUNTER
+
+static std::size_t AllocationCount = 0;
+
+extern "C" void* __libc_malloc(std::size_t);
+
+extern "C" void* malloc(std::size_t Size) noexcept {
+  ++AllocationCount;
+  return __libc_malloc(Size);
+}
+#endif
+
+inline std::size_t allocationCount() {
+#ifdef BENCHMARK_HAS_ALLOCATION_COUNTER
+  return AllocationCount;
+#else
+  return 0;
+#endif
+}
+
+// Reports the allocations made since Before, per iteration.
+inline void reportAllocations(benchmark::State& state, std::size_t Before) {
+#ifdef BENCHMARK_HAS_ALLOCATION_COUNTER
+  state.counters["Allocs"] = benchmark::Counter(
+      static_cast<double>(AllocationCount - Before),
+      benchmark::Counter::kAvgIterations);
+#else
+  (void)state;
+  (void)Before;
+#endif
+}
+
+#endif // BENCHMARK_ALLOCATION_COUNTER_HPP
@@ -79,6 +79,21 @@ void BM_EmplaceDuplicate(benchmark::State& st, Container c, GenInputs gen) {
     }
 }
 
+template <class Container, class GenInputs>
+void BM_EraseInsertChurn(benchmark::State& st, Container c, GenInputs gen) {
+    auto in = gen(st.range(0));
+    const auto end = in.end();
+    c.insert(in.begin(), in.end());
+    benchmark::DoNotOptimize(&c);
+    while (st.KeepRunning()) {
+        for (auto it = in.begin(); it != end; ++it) {
+            c.erase(*it);
+            benchmark::DoNotOptimize(&(*c.insert(*it).first));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
 template <class Container, class GenInputs>
 static void BM_Find(benchmark::State& st, Container c, GenInputs gen) {
     auto in = gen(st.range(0));
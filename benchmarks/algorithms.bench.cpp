@@ -1,7 +1,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <execution>
 #include <map>
+#include <numeric>
 #include <random>
 #include <string>
 #include <utility>
@@ -14,14 +16,22 @@
 
 namespace {
 
-enum class ValueType { Uint32, String };
-struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 2> {
-  static constexpr const char* Names[] = {"uint32", "string"};
+enum class ValueType { Uint32, Uint64, Double, String };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 4> {
+  static constexpr const char* Names[] = {"uint32", "uint64", "double",
+                                          "string"};
 };
 
 template <class V>
-using Value =
-    std::conditional_t<V() == ValueType::Uint32, uint32_t, std::string>;
+using Value = std::conditional_t<
+    V() == ValueType::Uint32, uint32_t,
+    std::conditional_t<
+        V() == ValueType::Uint64, uint64_t,
+        std::conditional_t<V() == ValueType::Double, double, std::string> > >;
+
+// Sizes past the last of the common quantities are only run for the
+// arithmetic value types, which std::sort and std::stable_sort radix sort.
+const size_t MaxStringQuantity = 1 << 18;
 
 enum class Order {
   Random,
@@ -29,17 +39,65 @@ enum class Order {
   Descending,
   SingleElement,
   PipeOrgan,
-  Heap
+  Heap,
+  QuickSortAdversary,
 };
-struct AllOrders : EnumValuesAsTuple<AllOrders, Order, 6> {
+struct AllOrders : EnumValuesAsTuple<AllOrders, Order, 7> {
   static constexpr const char* Names[] = {"Random",     "Ascending",
                                           "Descending", "SingleElement",
-                                          "PipeOrgan",  "Heap"};
+                                          "PipeOrgan",  "Heap",
+                                          "QuickSortAdversary"};
 };
 
-void fillValues(std::vector<uint32_t>& V, size_t N, Order O) {
+// Builds the input on which std::sort makes the most comparisons, following
+// McIlroy's "A Killer Adversary for Quicksort": values are only fixed when
+// the sort compares two still undecided elements, and the one that looks like
+// the pivot candidate gets the next smallest value.
+void fillAdversarialQuickSortInput(std::vector<uint32_t>& V, size_t N) {
+  assert(N > 0);
+  const uint32_t Gas = N - 1;
+  V.assign(N, Gas);
+  size_t Candidate = 0;
+  uint32_t NumSolid = 0;
+  std::vector<size_t> Indices(N);
+  std::iota(Indices.begin(), Indices.end(), 0);
+  std::sort(Indices.begin(), Indices.end(), [&](size_t X, size_t Y) {
+    if (V[X] == Gas && V[Y] == Gas) {
+      if (X == Candidate)
+        V[X] = NumSolid++;
+      else
+        V[Y] = NumSolid++;
+    }
+    if (V[X] == Gas)
+      Candidate = X;
+    else if (V[Y] == Gas)
+      Candidate = Y;
+    return V[X] < V[Y];
+  });
+}
+
+enum class Policy { Seq, Par };
+struct AllPolicies : EnumValuesAsTuple<AllPolicies, Policy, 2> {
+  static constexpr const char* Names[] = {"Seq", "Par"};
+};
+
+// Calls F with the execution policy object selected by P.
+template <class P, class F>
+TEST_ALWAYS_INLINE void withPolicy(F f) {
+  if (P() == Policy::Par)
+    f(std::execution::par);
+  else
+    f(std::execution::seq);
+}
+
+template <class T>
+void fillValues(std::vector<T>& V, size_t N, Order O) {
   if (O == Order::SingleElement) {
     V.resize(N, 0);
+  } else if (O == Order::QuickSortAdversary) {
+    std::vector<uint32_t> Adversary;
+    fillAdversarialQuickSortInput(Adversary, N);
+    V.assign(Adversary.begin(), Adversary.end());
   } else {
     while (V.size() < N)
       V.push_back(V.size());
@@ -58,7 +116,7 @@ void fillValues(std::vector<std::string>& V, size_t N, Order O) {
 
 template <class T>
 void sortValues(T& V, Order O) {
-  assert(std::is_sorted(V.begin(), V.end()));
+  assert(O == Order::QuickSortAdversary || std::is_sorted(V.begin(), V.end()));
   switch (O) {
   case Order::Random: {
     std::random_device R;
@@ -82,6 +140,9 @@ void sortValues(T& V, Order O) {
   case Order::Heap:
     std::make_heap(V.begin(), V.end());
     break;
+  case Order::QuickSortAdversary:
+    // Nothing to do
+    break;
   }
 }
 
@@ -137,7 +198,11 @@ struct Sort {
     });
   }
 
-  bool skip() const { return Order() == ::Order::Heap; }
+  bool skip() const {
+    return Order() == ::Order::Heap ||
+           (ValueType() == ::ValueType::String &&
+            Quantity > MaxStringQuantity);
+  }
 
   std::string name() const {
     return "BM_Sort" + ValueType::name() + Order::name() + "_" +
@@ -155,7 +220,11 @@ struct StableSort {
     });
   }
 
-  bool skip() const { return Order() == ::Order::Heap; }
+  bool skip() const {
+    return Order() == ::Order::Heap ||
+           (ValueType() == ::ValueType::String &&
+            Quantity > MaxStringQuantity);
+  }
 
   std::string name() const {
     return "BM_StableSort" + ValueType::name() + Order::name() + "_" +
@@ -248,6 +317,90 @@ struct PopHeap {
   };
 };
 
+// The policy benchmarks compare the serial algorithms with the parallel ones
+// over growing inputs, to show where handing work to the backend pays off.
+
+template <class ValueType, class Order, class Policy>
+struct SortPolicy {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(state, Quantity, Order(), false, [](auto& Copy) {
+      withPolicy<Policy>([&](const auto& P) {
+        std::sort(P, Copy.begin(), Copy.end());
+      });
+    });
+  }
+
+  bool skip() const { return Order() == ::Order::Heap; }
+
+  std::string name() const {
+    return "BM_Sort" + Policy::name() + ValueType::name() + Order::name() +
+           "_" + std::to_string(Quantity);
+  };
+};
+
+template <class ValueType, class Order, class Policy>
+struct StableSortPolicy {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(state, Quantity, Order(), false, [](auto& Copy) {
+      withPolicy<Policy>([&](const auto& P) {
+        std::stable_sort(P, Copy.begin(), Copy.end());
+      });
+    });
+  }
+
+  bool skip() const { return Order() == ::Order::Heap; }
+
+  std::string name() const {
+    return "BM_StableSort" + Policy::name() + ValueType::name() +
+           Order::name() + "_" + std::to_string(Quantity);
+  };
+};
+
+template <class Policy>
+struct ReducePolicy {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    std::vector<uint32_t> V(Quantity);
+    std::iota(V.begin(), V.end(), 0);
+    while (state.KeepRunningBatch(Quantity)) {
+      withPolicy<Policy>([&](const auto& P) {
+        benchmark::DoNotOptimize(std::reduce(P, V.begin(), V.end(), uint64_t()));
+      });
+    }
+  }
+
+  std::string name() const {
+    return "BM_Reduce" + Policy::name() + "_" + std::to_string(Quantity);
+  };
+};
+
+template <class Policy>
+struct InclusiveScanPolicy {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    std::vector<uint32_t> V(Quantity);
+    std::vector<uint32_t> Out(Quantity);
+    std::iota(V.begin(), V.end(), 0);
+    while (state.KeepRunningBatch(Quantity)) {
+      withPolicy<Policy>([&](const auto& P) {
+        std::inclusive_scan(P, V.begin(), V.end(), Out.begin());
+      });
+      benchmark::DoNotOptimize(Out.data());
+    }
+  }
+
+  std::string name() const {
+    return "BM_InclusiveScan" + Policy::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -257,14 +410,27 @@ int main(int argc, char** argv) {
 
   const std::vector<size_t> Quantities = {1 << 0, 1 << 2,  1 << 4,  1 << 6,
                                           1 << 8, 1 << 10, 1 << 14, 1 << 18};
-  makeCartesianProductBenchmark<Sort, AllValueTypes, AllOrders>(Quantities);
+  std::vector<size_t> SortQuantities = Quantities;
+  SortQuantities.push_back(1 << 20);
+  SortQuantities.push_back(1 << 24);
+  makeCartesianProductBenchmark<Sort, AllValueTypes, AllOrders>(
+      SortQuantities);
   makeCartesianProductBenchmark<StableSort, AllValueTypes, AllOrders>(
-      Quantities);
+      SortQuantities);
   makeCartesianProductBenchmark<MakeHeap, AllValueTypes, AllOrders>(Quantities);
   makeCartesianProductBenchmark<SortHeap, AllValueTypes>(Quantities);
   makeCartesianProductBenchmark<MakeThenSortHeap, AllValueTypes, AllOrders>(
       Quantities);
   makeCartesianProductBenchmark<PushHeap, AllValueTypes, AllOrders>(Quantities);
   makeCartesianProductBenchmark<PopHeap, AllValueTypes>(Quantities);
+
+  const std::vector<size_t> PolicyQuantities = {1 << 10, 1 << 14, 1 << 18};
+  makeCartesianProductBenchmark<SortPolicy, AllValueTypes, AllOrders,
+                                AllPolicies>(PolicyQuantities);
+  makeCartesianProductBenchmark<StableSortPolicy, AllValueTypes, AllOrders,
+                                AllPolicies>(PolicyQuantities);
+  makeCartesianProductBenchmark<ReducePolicy, AllPolicies>(PolicyQuantities);
+  makeCartesianProductBenchmark<InclusiveScanPolicy, AllPolicies>(
+      PolicyQuantities);
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -0,0 +1,207 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+constexpr std::size_t TestNumInputs = 1024;
+
+enum class Distribution { Uniform, Integral, Small };
+
+struct AllDistributions : EnumValuesAsTuple<AllDistributions, Distribution, 3> {
+  static constexpr const char* Names[] = {"Uniform", "Integral", "Small"};
+};
+
+// Format values match the chars_format ones, with Plain selecting the
+// overload without a format.
+enum class Format { Plain, Scientific, Fixed, General, Hex };
+
+struct AllFormats : EnumValuesAsTuple<AllFormats, Format, 5> {
+  static constexpr const char* Names[] = {"Plain", "Scientific", "Fixed",
+                                          "General", "Hex"};
+};
+
+// The printf conversions the to_chars formats replace.
+const char* printfFormat(Format F) {
+  switch (F) {
+  case Format::Plain:
+  case Format::General:
+    return "%.17g";
+  case Format::Scientific:
+    return "%.17e";
+  case Format::Fixed:
+    return "%f";
+  case Format::Hex:
+    return "%a";
+  }
+  return "";
+}
+
+enum class ValueType { Float, Double };
+
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 2> {
+  static constexpr const char* Names[] = {"Float", "Double"};
+};
+
+template <class V>
+using Value =
+    typename std::conditional<V() == ValueType::Float, float, double>::type;
+
+template <class T>
+std::vector<T> makeInputs(Distribution D) {
+  std::mt19937_64 Gen(42);
+  std::vector<T> Inputs;
+  while (Inputs.size() < TestNumInputs) {
+    T V;
+    switch (D) {
+    case Distribution::Uniform: {
+      // Every bit pattern except the non-finite ones.
+      typename std::conditional<sizeof(T) == 4, std::uint32_t,
+                                std::uint64_t>::type Bits = Gen();
+      std::memcpy(&V, &Bits, sizeof(V));
+      if (!(V - V == 0))
+        continue;
+      break;
+    }
+    case Distribution::Integral:
+      V = static_cast<T>(Gen() % 1000000);
+      break;
+    case Distribution::Small:
+      V = static_cast<T>(Gen() % 100000) / 1000;
+      break;
+    }
+    Inputs.push_back(V);
+  }
+  return Inputs;
+}
+
+template <class Type, class Dist, class Fmt>
+struct ToChars {
+  static void run(benchmark::State& state) {
+    using T = Value<Type>;
+    const auto Inputs = makeInputs<T>(Dist());
+    char Buffer[512];
+    for (auto _ : state) {
+      for (T V : Inputs) {
+        std::to_chars_result R =
+            Fmt() == Format::Plain
+                ? std::to_chars(Buffer, Buffer + sizeof(Buffer), V)
+                : std::to_chars(Buffer, Buffer + sizeof(Buffer), V,
+                                static_cast<std::chars_format>(Fmt()()));
+        benchmark::DoNotOptimize(R);
+      }
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Inputs.size());
+  }
+
+  static std::string name() {
+    return "BM_ToChars" + Type::name() + Dist::name() + Fmt::name();
+  }
+};
+
+template <class Type, class Dist, class Fmt>
+struct Snprintf {
+  static void run(benchmark::State& state) {
+    using T = Value<Type>;
+    const auto Inputs = makeInputs<T>(Dist());
+    const char* F = printfFormat(Fmt());
+    char Buffer[512];
+    for (auto _ : state) {
+      for (T V : Inputs)
+        benchmark::DoNotOptimize(
+            std::snprintf(Buffer, sizeof(Buffer), F, static_cast<double>(V)));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Inputs.size());
+  }
+
+  static std::string name() {
+    return "BM_Snprintf" + Type::name() + Dist::name() + Fmt::name();
+  }
+};
+
+// The parsing benchmarks read back the shortest representation of the
+// inputs, the usual case for text produced by to_chars.
+template <class T>
+std::vector<std::string> makeStrings(Distribution D) {
+  std::vector<std::string> Strings;
+  char Buffer[64];
+  for (T V : makeInputs<T>(D))
+    Strings.emplace_back(Buffer,
+                         std::to_chars(Buffer, Buffer + sizeof(Buffer), V).ptr);
+  return Strings;
+}
+
+template <class Type, class Dist>
+struct FromChars {
+  static void run(benchmark::State& state) {
+    using T = Value<Type>;
+    const auto Strings = makeStrings<T>(Dist());
+    for (auto _ : state) {
+      for (const std::string& S : Strings) {
+        T V;
+        benchmark::DoNotOptimize(
+            std::from_chars(S.data(), S.data() + S.size(), V));
+        benchmark::DoNotOptimize(V);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * Strings.size());
+  }
+
+  static std::string name() {
+    return "BM_FromChars" + Type::name() + Dist::name();
+  }
+};
+
+template <class Type, class Dist>
+struct Strtod {
+  static void run(benchmark::State& state) {
+    using T = Value<Type>;
+    const auto Strings = makeStrings<T>(Dist());
+    for (auto _ : state) {
+      for (const std::string& S : Strings)
+        benchmark::DoNotOptimize(
+            sizeof(T) == sizeof(float) ? std::strtof(S.c_str(), nullptr)
+                                       : std::strtod(S.c_str(), nullptr));
+    }
+    state.SetItemsProcessed(state.iterations() * Strings.size());
+  }
+
+  static std::string name() {
+    return "BM_Strtod" + Type::name() + Dist::name();
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  makeCartesianProductBenchmark<ToChars, AllValueTypes, AllDistributions,
+                                AllFormats>();
+  makeCartesianProductBenchmark<Snprintf, AllValueTypes, AllDistributions,
+                                AllFormats>();
+  makeCartesianProductBenchmark<FromChars, AllValueTypes, AllDistributions>();
+  makeCartesianProductBenchmark<Strtod, AllValueTypes, AllDistributions>();
+  benchmark::RunSpecifiedBenchmarks();
+}
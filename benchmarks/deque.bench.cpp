@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <string>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+enum class Algorithm { ForEach, Find, Count, CountIf, Fill, Accumulate, Copy };
+
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 7> {
+  static constexpr const char* Names[] = {"ForEach", "Find", "Count", "CountIf",
+                                          "Fill", "Accumulate", "Copy"};
+};
+
+template <class A>
+struct DequeAlgorithm {
+  size_t Size;
+  DequeAlgorithm(size_t S) : Size(S) {}
+
+  void run(benchmark::State& State) const {
+    // Start off the beginning of a block, like a deque that has been used as
+    // a queue.
+    std::deque<uint32_t> D(Size + 100);
+    D.erase(D.begin(), D.begin() + 100);
+    std::iota(D.begin(), D.end(), uint32_t{0});
+    std::deque<uint32_t> Out(Size);
+    while (State.KeepRunningBatch(Size)) {
+      switch (A()) {
+      case Algorithm::ForEach: {
+        uint32_t Sum = 0;
+        std::for_each(D.begin(), D.end(), [&](uint32_t X) { Sum += X; });
+        benchmark::DoNotOptimize(Sum);
+        break;
+      }
+      case Algorithm::Find:
+        benchmark::DoNotOptimize(std::find(D.begin(), D.end(), uint32_t(-1)));
+        break;
+      case Algorithm::Count:
+        benchmark::DoNotOptimize(std::count(D.begin(), D.end(), uint32_t{7}));
+        break;
+      case Algorithm::CountIf:
+        benchmark::DoNotOptimize(std::count_if(
+            D.begin(), D.end(), [](uint32_t X) { return X % 3 == 0; }));
+        break;
+      case Algorithm::Fill:
+        std::fill(D.begin(), D.end(), uint32_t{7});
+        benchmark::ClobberMemory();
+        break;
+      case Algorithm::Accumulate:
+        benchmark::DoNotOptimize(std::accumulate(D.begin(), D.end(), uint64_t{0}));
+        break;
+      case Algorithm::Copy:
+        std::copy(D.begin(), D.end(), Out.begin());
+        benchmark::ClobberMemory();
+        break;
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_Deque" + A::name() + "_" + std::to_string(Size);
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  const std::vector<size_t> Sizes{1 << 10, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<DequeAlgorithm, AllAlgorithms>(Sizes);
+  benchmark::RunSpecifiedBenchmarks();
+}
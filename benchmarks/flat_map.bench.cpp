@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<experimental/flat_map>)
+#include <experimental/flat_map>
+#define HAS_FLAT_MAP
+#endif
+#endif
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+enum class MapKind { Map, FlatMap };
+
+#ifdef HAS_FLAT_MAP
+struct AllMapKinds : EnumValuesAsTuple<AllMapKinds, MapKind, 2> {
+  static constexpr const char* Names[] = {"Map", "FlatMap"};
+};
+
+using FlatMap = std::experimental::flat_map<uint64_t, uint64_t>;
+#else
+// The native standard library has no flat_map: measure std::map alone.
+struct AllMapKinds : EnumValuesAsTuple<AllMapKinds, MapKind, 1> {
+  static constexpr const char* Names[] = {"Map"};
+};
+#endif
+
+using Map = std::map<uint64_t, uint64_t>;
+
+std::vector<std::pair<uint64_t, uint64_t> > makeSortedPairs(size_t Size) {
+  std::vector<std::pair<uint64_t, uint64_t> > V;
+  for (uint64_t I = 0; I < Size; ++I)
+    V.push_back(std::make_pair(2 * I, I));
+  return V;
+}
+
+template <class Container>
+Container buildFromSorted(const std::vector<std::pair<uint64_t, uint64_t> >& V) {
+  return Container(V.begin(), V.end());
+}
+
+#ifdef HAS_FLAT_MAP
+template <>
+FlatMap buildFromSorted<FlatMap>(
+    const std::vector<std::pair<uint64_t, uint64_t> >& V) {
+  return FlatMap(std::experimental::sorted_unique, V.begin(), V.end());
+}
+#endif
+
+template <class Kind, class F>
+void withContainer(F f) {
+#ifdef HAS_FLAT_MAP
+  if (Kind() == MapKind::FlatMap)
+    return f(FlatMap());
+#endif
+  f(Map());
+}
+
+struct Base {
+  size_t MapSize;
+  Base(size_t S) : MapSize(S) {}
+
+  std::string baseName() const { return "_MapSize" + std::to_string(MapSize); }
+};
+
+// Build once from sorted data, the read-mostly case the flat containers are
+// for.
+template <class Kind>
+struct BuildFromSorted : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    auto V = makeSortedPairs(MapSize);
+    withContainer<Kind>([&](auto Empty) {
+      using Container = decltype(Empty);
+      while (State.KeepRunningBatch(MapSize)) {
+        Container C = buildFromSorted<Container>(V);
+        benchmark::DoNotOptimize(&C);
+      }
+    });
+  }
+
+  std::string name() const {
+    return "BM_BuildFromSorted" + Kind::name() + baseName();
+  }
+};
+
+// Look up every key, hit or miss, in random order.
+template <class Kind>
+struct FindRandom : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    auto V = makeSortedPairs(MapSize);
+    std::vector<uint64_t> Keys(2 * MapSize);
+    std::iota(Keys.begin(), Keys.end(), uint64_t{0});
+    std::shuffle(Keys.begin(), Keys.end(), std::mt19937());
+    withContainer<Kind>([&](auto Empty) {
+      using Container = decltype(Empty);
+      Container C = buildFromSorted<Container>(V);
+      while (State.KeepRunningBatch(Keys.size())) {
+        for (auto K : Keys)
+          benchmark::DoNotOptimize(C.find(K));
+      }
+    });
+  }
+
+  std::string name() const {
+    return "BM_FindRandom" + Kind::name() + baseName();
+  }
+};
+
+// Merge a sorted batch of MapSize new keys, interleaved with the existing
+// ones, into a map of MapSize elements.
+template <class Kind>
+struct InsertSortedBatch : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    auto V = makeSortedPairs(MapSize);
+    std::vector<std::pair<uint64_t, uint64_t> > Batch;
+    for (auto& P : V)
+      Batch.push_back(std::make_pair(P.first + 1, P.second));
+    withContainer<Kind>([&](auto Empty) {
+      using Container = decltype(Empty);
+      while (State.KeepRunningBatch(MapSize)) {
+        State.PauseTiming();
+        Container C = buildFromSorted<Container>(V);
+        State.ResumeTiming();
+        insertSorted(C, Batch);
+        benchmark::DoNotOptimize(&C);
+      }
+    });
+  }
+
+  static void insertSorted(Map& C,
+                           const std::vector<std::pair<uint64_t, uint64_t> >& B) {
+    C.insert(B.begin(), B.end());
+  }
+#ifdef HAS_FLAT_MAP
+  static void insertSorted(FlatMap& C,
+                           const std::vector<std::pair<uint64_t, uint64_t> >& B) {
+    C.insert(std::experimental::sorted_unique, B.begin(), B.end());
+  }
+#endif
+
+  std::string name() const {
+    return "BM_InsertSortedBatch" + Kind::name() + baseName();
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  const std::vector<size_t> MapSize{16, 256, 4096, 65536, 1048576};
+
+  makeCartesianProductBenchmark<BuildFromSorted, AllMapKinds>(MapSize);
+  makeCartesianProductBenchmark<FindRandom, AllMapKinds>(MapSize);
+  makeCartesianProductBenchmark<InsertSortedBatch, AllMapKinds>(MapSize);
+  benchmark::RunSpecifiedBenchmarks();
+}
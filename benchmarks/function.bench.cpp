@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 
+#include "AllocationCounter.hpp"
 #include "CartesianBenchmarks.hpp"
 #include "benchmark/benchmark.h"
 #include "test_macros.h"
@@ -105,6 +106,7 @@ inline Function MakeFunction(FunctionType type, bool opaque = false) {
 template <class Opacity, class FunctionType>
 struct ConstructAndDestroy {
   static void run(benchmark::State& state) {
+    const std::size_t Before = allocationCount();
     for (auto _ : state) {
       if (Opacity() == ::Opacity::kOpaque) {
         benchmark::DoNotOptimize(MakeFunction(FunctionType(), true));
@@ -112,6 +114,7 @@ struct ConstructAndDestroy {
         MakeFunction(FunctionType());
       }
     }
+    reportAllocations(state, Before);
   }
 
   static std::string name() {
@@ -123,11 +126,13 @@ template <class FunctionType>
 struct Copy {
   static void run(benchmark::State& state) {
     auto value = MakeFunction(FunctionType());
+    const std::size_t Before = allocationCount();
     for (auto _ : state) {
       benchmark::DoNotOptimize(value);
       auto copy = value;  // NOLINT
       benchmark::DoNotOptimize(copy);
     }
+    reportAllocations(state, Before);
   }
 
   static std::string name() { return "BM_Copy" + FunctionType::name(); }
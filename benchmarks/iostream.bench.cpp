@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+constexpr int NumValues = 1 << 16;
+
+enum class Mode { Synced, Unsynced };
+
+struct AllModes : EnumValuesAsTuple<AllModes, Mode, 2> {
+  static constexpr const char* Names[] = {"Synced", "Unsynced"};
+};
+
+enum class Operation { WriteInt, WriteWord, WriteChar, ReadInt, ReadWord, ReadLine };
+
+struct AllOperations : EnumValuesAsTuple<AllOperations, Operation, 6> {
+  static constexpr const char* Names[] = {"WriteInt", "WriteWord", "WriteChar",
+                                          "ReadInt",  "ReadWord",  "ReadLine"};
+};
+
+// Points a standard file descriptor at another file for the duration of a
+// benchmark, so that cout does not write over the benchmark report.
+class Redirect {
+  int Fd;
+  int Saved;
+
+public:
+  Redirect(int F, const char* Path, int Flags) : Fd(F), Saved(dup(F)) {
+    int New = open(Path, Flags, 0600);
+    dup2(New, Fd);
+    close(New);
+  }
+  ~Redirect() {
+    dup2(Saved, Fd);
+    close(Saved);
+  }
+};
+
+std::string makeInput() {
+  char Name[] = "/tmp/libcxx-iostream-bench-XXXXXX";
+  int Fd = mkstemp(Name);
+  std::string Data;
+  for (int I = 0; I < NumValues; ++I)
+    Data += std::to_string(I * 7919) + (I % 8 == 7 ? "\n" : " ");
+  if (write(Fd, Data.data(), Data.size()) != static_cast<ssize_t>(Data.size()))
+    std::abort();
+  close(Fd);
+  return Name;
+}
+
+template <class M, class Op>
+struct StdStreams {
+  void run(benchmark::State& State) const {
+    std::ios_base::sync_with_stdio(M() == Mode::Synced);
+    std::cin.tie(nullptr);
+    if (Op() == Operation::ReadInt || Op() == Operation::ReadWord ||
+        Op() == Operation::ReadLine)
+      runRead(State);
+    else
+      runWrite(State);
+    std::ios_base::sync_with_stdio(true);
+  }
+
+  void runWrite(benchmark::State& State) const {
+    std::cout.flush();
+    std::fflush(stdout);
+    Redirect R(1, "/dev/null", O_WRONLY);
+    while (State.KeepRunningBatch(NumValues)) {
+      for (int I = 0; I < NumValues; ++I) {
+        switch (Op()) {
+        case Operation::WriteInt:
+          std::cout << I << ' ';
+          break;
+        case Operation::WriteWord:
+          std::cout << "word ";
+          break;
+        default:
+          std::cout.put('x');
+          break;
+        }
+      }
+    }
+    std::cout.flush();
+    std::fflush(stdout);
+  }
+
+  void runRead(benchmark::State& State) const {
+    static const std::string Input = makeInput();
+    Redirect R(0, Input.c_str(), O_RDONLY);
+    std::string Word;
+    while (State.KeepRunningBatch(NumValues)) {
+      std::cin.clear();
+      std::clearerr(stdin);
+      std::fseek(stdin, 0, SEEK_SET);
+      switch (Op()) {
+      case Operation::ReadInt:
+        for (int X; std::cin >> X;)
+          benchmark::DoNotOptimize(X);
+        break;
+      case Operation::ReadWord:
+        while (std::cin >> Word)
+          benchmark::DoNotOptimize(Word.data());
+        break;
+      default:
+        while (std::getline(std::cin, Word))
+          benchmark::DoNotOptimize(Word.data());
+        break;
+      }
+    }
+    std::cin.clear();
+  }
+
+  std::string name() const { return "BM_StdStream" + Op::name() + M::name(); }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  makeCartesianProductBenchmark<StdStreams, AllModes, AllOperations>();
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdint>
+#include <experimental/memory_resource>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+namespace pmr = std::experimental::pmr;
+
+// Where the nodes come from.  Std is the plain std::allocator; the others are
+// a polymorphic_allocator over the named resource.
+enum class Resource { Std, NewDelete, UnsyncPool, SyncPool, Monotonic };
+
+struct AllResources : EnumValuesAsTuple<AllResources, Resource, 5> {
+  static constexpr const char* Names[] = {"Std", "NewDelete", "UnsyncPool",
+                                          "SyncPool", "Monotonic"};
+};
+
+enum class Container { List, Map, UnorderedSet };
+
+struct AllContainers : EnumValuesAsTuple<AllContainers, Container, 3> {
+  static constexpr const char* Names[] = {"List", "Map", "UnorderedSet"};
+};
+
+template <class Alloc>
+using ListOf = std::list<uint64_t, Alloc>;
+
+template <class Alloc>
+using MapOf =
+    std::map<uint64_t, uint64_t, std::less<uint64_t>,
+             typename std::allocator_traits<Alloc>::template rebind_alloc<
+                 std::pair<const uint64_t, uint64_t> > >;
+
+template <class Alloc>
+using UnorderedSetOf =
+    std::unordered_set<uint64_t, std::hash<uint64_t>,
+                       std::equal_to<uint64_t>, Alloc>;
+
+template <class C>
+void insert(ListOf<typename C::allocator_type>& L, uint64_t V) {
+  L.push_back(V);
+}
+
+template <class C>
+void insert(MapOf<typename C::allocator_type>& M, uint64_t V) {
+  M.emplace(V, V);
+}
+
+template <class C>
+void insert(UnorderedSetOf<typename C::allocator_type>& S, uint64_t V) {
+  S.insert(V);
+}
+
+template <class C>
+void fillAndDestroy(size_t Quantity,
+                    const typename C::allocator_type& A) {
+  C Cont(A);
+  for (size_t I = 0; I != Quantity; ++I)
+    insert<C>(Cont, I * 0x9E3779B97F4A7C15ULL);
+  benchmark::DoNotOptimize(Cont);
+}
+
+template <template <class> class ContainerOf, class R>
+void runWithResource(benchmark::State& state, size_t Quantity) {
+  using StdC = ContainerOf<std::allocator<uint64_t> >;
+  using PmrC = ContainerOf<pmr::polymorphic_allocator<uint64_t> >;
+  while (state.KeepRunningBatch(Quantity)) {
+    switch (R()) {
+    case Resource::Std:
+      fillAndDestroy<StdC>(Quantity, std::allocator<uint64_t>());
+      break;
+    case Resource::NewDelete:
+      fillAndDestroy<PmrC>(Quantity, pmr::new_delete_resource());
+      break;
+    case Resource::UnsyncPool: {
+      pmr::unsynchronized_pool_resource Res;
+      fillAndDestroy<PmrC>(Quantity, &Res);
+      break;
+    }
+    case Resource::SyncPool: {
+      pmr::synchronized_pool_resource Res;
+      fillAndDestroy<PmrC>(Quantity, &Res);
+      break;
+    }
+    case Resource::Monotonic: {
+      pmr::monotonic_buffer_resource Res;
+      fillAndDestroy<PmrC>(Quantity, &Res);
+      break;
+    }
+    }
+  }
+}
+
+// Builds a container of Quantity elements and tears it down again, so the
+// numbers include both the allocations and the deallocations of the nodes.
+template <class Cont, class R>
+struct FillAndDestroy {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    switch (Cont()) {
+    case Container::List:
+      runWithResource<ListOf, R>(state, Quantity);
+      break;
+    case Container::Map:
+      runWithResource<MapOf, R>(state, Quantity);
+      break;
+    case Container::UnorderedSet:
+      runWithResource<UnorderedSetOf, R>(state, Quantity);
+      break;
+    }
+  }
+
+  std::string name() const {
+    return "BM_FillAndDestroy" + Cont::name() + R::name() + "_" +
+           std::to_string(Quantity);
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  const std::vector<size_t> Quantities = {1 << 6, 1 << 10, 1 << 14, 1 << 18};
+  makeCartesianProductBenchmark<FillAndDestroy, AllContainers, AllResources>(
+      Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -13,6 +13,12 @@
 #include <set>
 #include <string>
 #include <vector>
+#if defined(__has_include)
+#if __has_include(<experimental/node_pool_allocator>)
+#include <experimental/node_pool_allocator>
+#define HAS_NODE_POOL_ALLOCATOR
+#endif
+#endif
 
 #include "CartesianBenchmarks.hpp"
 #include "benchmark/benchmark.h"
@@ -101,6 +107,29 @@ struct Create : Base {
   }
 };
 
+template <class Access>
+struct CreateFromRange : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::vector<uint64_t> Keys(TableSize);
+    std::iota(Keys.begin(), Keys.end(), uint64_t{0});
+    sortKeysBy(Keys, Access());
+
+    while (State.KeepRunningBatch(TableSize * NumTables)) {
+      std::vector<std::set<uint64_t>> Sets;
+      Sets.reserve(NumTables);
+      for (size_t I = 0; I < NumTables; ++I)
+        Sets.emplace_back(Keys.begin(), Keys.end());
+      benchmark::DoNotOptimize(Sets.data());
+    }
+  }
+
+  std::string name() const {
+    return "BM_CreateFromRange" + Access::name() + baseName();
+  }
+};
+
 template <class Hit, class Access>
 struct Find : Base {
   using Base::Base;
@@ -185,6 +214,36 @@ struct InsertMissAndErase : Base {
   }
 };
 
+#ifdef HAS_NODE_POOL_ALLOCATOR
+// The same churn as InsertMissAndErase, with nodes recycled by a pool
+// instead of going back to malloc.
+template <class Access>
+struct InsertMissAndErasePooled : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    using Alloc = std::experimental::node_pool_allocator<uint64_t>;
+    using PooledSet = std::set<uint64_t, std::less<uint64_t>, Alloc>;
+    auto Data = makeTestingSets(TableSize, NumTables, HitType::Miss, Access());
+    std::vector<PooledSet> Sets;
+    for (auto& Set : Data.Sets)
+      Sets.emplace_back(Set.begin(), Set.end());
+
+    while (State.KeepRunningBatch(TableSize * NumTables)) {
+      for (auto K : Data.Keys) {
+        for (auto& Set : Sets) {
+          benchmark::DoNotOptimize(Set.erase(Set.insert(K).first));
+        }
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_InsertMissAndErasePooled" + Access::name() + baseName();
+  }
+};
+#endif
+
 struct IterateRangeFor : Base {
   using Base::Base;
 
@@ -234,6 +293,8 @@ int main(int argc, char** argv) {
   const std::vector<size_t> NumTables{1, 10, 100, 1000, 10000, 100000, 1000000};
 
   makeCartesianProductBenchmark<Create, AllAccessPattern>(TableSize, NumTables);
+  makeCartesianProductBenchmark<CreateFromRange, AllAccessPattern>(TableSize,
+                                                                   NumTables);
   makeCartesianProductBenchmark<Find, AllHitTypes, AllAccessPattern>(
       TableSize, NumTables);
   makeCartesianProductBenchmark<FindNeEnd, AllHitTypes, AllAccessPattern>(
@@ -242,6 +303,10 @@ int main(int argc, char** argv) {
       TableSize, NumTables);
   makeCartesianProductBenchmark<InsertMissAndErase, AllAccessPattern>(
       TableSize, NumTables);
+#ifdef HAS_NODE_POOL_ALLOCATOR
+  makeCartesianProductBenchmark<InsertMissAndErasePooled, AllAccessPattern>(
+      TableSize, NumTables);
+#endif
   makeCartesianProductBenchmark<IterateRangeFor>(TableSize, NumTables);
   makeCartesianProductBenchmark<IterateBeginEnd>(TableSize, NumTables);
   benchmark::RunSpecifiedBenchmarks();
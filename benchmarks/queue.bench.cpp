@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdint>
+#include <deque>
+#include <queue>
+#include <string>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+struct Message {
+  uint64_t Words[8];
+  explicit Message(uint64_t V = 0) { Words[0] = V; }
+};
+
+enum class ValueType { Int, Message };
+
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 2> {
+  static constexpr const char* Names[] = {"Int", "Message"};
+};
+
+template <class V>
+using ValueT =
+    typename std::conditional<V() == ValueType::Int, uint64_t, Message>::type;
+
+struct Base {
+  size_t Depth;
+  Base(size_t D) : Depth(D) {}
+
+  std::string baseName() const { return "_Depth" + std::to_string(Depth); }
+};
+
+// Steady FIFO traffic: one push at the back and one pop at the front per
+// operation, with Depth elements queued.
+template <class V>
+struct SteadyFifo : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::queue<ValueT<V> > Q;
+    for (size_t I = 0; I < Depth; ++I)
+      Q.push(ValueT<V>(I));
+    uint64_t N = 0;
+    while (State.KeepRunningBatch(1024)) {
+      for (int I = 0; I < 1024; ++I) {
+        Q.push(ValueT<V>(++N));
+        benchmark::DoNotOptimize(&Q.front());
+        Q.pop();
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_SteadyFifo" + V::name() + baseName();
+  }
+};
+
+// Producer and consumer taking turns: Depth elements are queued and then all
+// of them are consumed, so the queue keeps growing and draining.
+template <class V>
+struct BurstFifo : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::queue<ValueT<V> > Q;
+    uint64_t N = 0;
+    while (State.KeepRunningBatch(Depth)) {
+      for (size_t I = 0; I < Depth; ++I)
+        Q.push(ValueT<V>(++N));
+      while (!Q.empty()) {
+        benchmark::DoNotOptimize(&Q.front());
+        Q.pop();
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_BurstFifo" + V::name() + baseName();
+  }
+};
+
+// Work stealing pattern: the owner pushes and pops at the back while the
+// other end is drained from the front.
+template <class V>
+struct BurstDeque : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::deque<ValueT<V> > D;
+    uint64_t N = 0;
+    while (State.KeepRunningBatch(2 * Depth)) {
+      for (size_t I = 0; I < Depth; ++I)
+        D.push_back(ValueT<V>(++N));
+      for (size_t I = 0; I < Depth / 2; ++I)
+        D.pop_back();
+      for (size_t I = 0; I < Depth / 2; ++I)
+        D.push_front(ValueT<V>(++N));
+      while (!D.empty()) {
+        benchmark::DoNotOptimize(&D.front());
+        D.pop_front();
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_BurstDeque" + V::name() + baseName();
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  const std::vector<size_t> Depth{1, 64, 1024, 4096, 65536};
+
+  makeCartesianProductBenchmark<SteadyFifo, AllValueTypes>(Depth);
+  makeCartesianProductBenchmark<BurstFifo, AllValueTypes>(Depth);
+  makeCartesianProductBenchmark<BurstDeque, AllValueTypes>(Depth);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <iterator>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+// A log-like haystack: many short lines, none of which mention "timeout".
+std::string makeLog(std::size_t Size) {
+  static const char* const Lines[] = {
+      "2020-01-01 12:00:00 INFO request served in 12ms path=/index.html\n",
+      "2020-01-01 12:00:01 DEBUG cache hit key=user:1234 size=512\n",
+      "2020-01-01 12:00:02 WARN slow query table=orders rows=10000\n",
+  };
+  std::string S;
+  for (std::size_t I = 0; S.size() < Size; ++I)
+    S += Lines[I % 3];
+  S.resize(Size);
+  return S;
+}
+
+void runSearch(benchmark::State& State, const std::string& Subject,
+               const std::regex& Re) {
+  for (auto _ : State) {
+    std::smatch M;
+    benchmark::DoNotOptimize(std::regex_search(Subject, M, Re));
+  }
+  State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) *
+                          static_cast<int64_t>(Subject.size()));
+}
+
+// A literal that never occurs.
+void BM_RegexSearchLiteralNoMatch(benchmark::State& State) {
+  runSearch(State, makeLog(State.range(0)), std::regex("timeout"));
+}
+BENCHMARK(BM_RegexSearchLiteralNoMatch)->Range(1 << 10, 1 << 18);
+
+// A literal prefix followed by a capture, matching near the end.
+void BM_RegexSearchPrefixAtEnd(benchmark::State& State) {
+  std::string S = makeLog(State.range(0));
+  S += "2020-01-01 12:00:03 ERROR: 503\n";
+  runSearch(State, S, std::regex("ERROR: (\\d+)"));
+}
+BENCHMARK(BM_RegexSearchPrefixAtEnd)->Range(1 << 10, 1 << 18);
+
+// A literal in the middle of the pattern that never occurs.
+void BM_RegexSearchRequiredNoMatch(benchmark::State& State) {
+  runSearch(State, makeLog(State.range(0)),
+            std::regex("(\\w+) code=(\\d+)"));
+}
+BENCHMARK(BM_RegexSearchRequiredNoMatch)->Range(1 << 10, 1 << 18);
+
+// An alternation of literals that never occurs.
+void BM_RegexSearchAlternationNoMatch(benchmark::State& State) {
+  runSearch(State, makeLog(State.range(0)),
+            std::regex("ERROR|FATAL|timeout"));
+}
+BENCHMARK(BM_RegexSearchAlternationNoMatch)->Range(1 << 10, 1 << 18);
+
+// Character classes and captures, matching at the very end of the input.
+void BM_RegexSearchCapturesAtEnd(benchmark::State& State) {
+  std::string S = makeLog(State.range(0));
+  S += "2020-01-01 12:00:03 ERROR code=503\n";
+  runSearch(State, S, std::regex("(\\w+) code=(\\d+)"));
+}
+BENCHMARK(BM_RegexSearchCapturesAtEnd)->Range(1 << 10, 1 << 18);
+
+// The same search with the POSIX leftmost-longest rule.
+void BM_RegexSearchExtendedAtEnd(benchmark::State& State) {
+  std::string S = makeLog(State.range(0));
+  S += "2020-01-01 12:00:03 ERROR code=503\n";
+  runSearch(State, S,
+            std::regex("[A-Z]+ code=[0-9]+", std::regex::extended));
+}
+BENCHMARK(BM_RegexSearchExtendedAtEnd)->Range(1 << 10, 1 << 18);
+
+// Nested quantifiers that make a backtracking matcher exponential.  The
+// pattern ends in a bracket expression, so no required literal lets
+// regex_match reject the input without running the matcher.
+void BM_RegexMatchNestedQuantifiers(benchmark::State& State) {
+  std::string S(State.range(0), 'a');
+  std::regex Re("(a|aa)*[bc]");
+  for (auto _ : State)
+    benchmark::DoNotOptimize(std::regex_match(S, Re));
+}
+BENCHMARK(BM_RegexMatchNestedQuantifiers)->Range(8, 1 << 12);
+
+// Whole-string validation of a line with a simple structure.
+void BM_RegexMatchLine(benchmark::State& State) {
+  std::string S = makeLog(State.range(0));
+  S.erase(S.find('\n'));
+  std::regex Re("\\d{4}-\\d{2}-\\d{2} [0-9:]+ [A-Z]+ .*");
+  for (auto _ : State)
+    benchmark::DoNotOptimize(std::regex_match(S, Re));
+}
+BENCHMARK(BM_RegexMatchLine)->Arg(1 << 10);
+
+// Searching many short lines with the same match_results.
+void BM_RegexSearchLines(benchmark::State& State) {
+  std::string Log = makeLog(State.range(0));
+  std::vector<std::string> Lines;
+  for (std::size_t I = 0, J; (J = Log.find('\n', I)) != std::string::npos;
+       I = J + 1)
+    Lines.push_back(Log.substr(I, J - I));
+  std::regex Re("(\\w+)=(\\S+)");
+  std::smatch M;
+  for (auto _ : State) {
+    for (const std::string& L : Lines)
+      benchmark::DoNotOptimize(std::regex_search(L, M, Re));
+  }
+  State.SetItemsProcessed(static_cast<int64_t>(State.iterations()) *
+                          static_cast<int64_t>(Lines.size()));
+}
+BENCHMARK(BM_RegexSearchLines)->Range(1 << 10, 1 << 16);
+
+// Iterating over every match in the input.
+void BM_RegexIterator(benchmark::State& State) {
+  std::string S = makeLog(State.range(0));
+  std::regex Re("\\w+=\\w+");
+  for (auto _ : State) {
+    std::ptrdiff_t N = std::distance(
+        std::sregex_iterator(S.begin(), S.end(), Re), std::sregex_iterator());
+    benchmark::DoNotOptimize(N);
+  }
+  State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) *
+                          static_cast<int64_t>(S.size()));
+}
+BENCHMARK(BM_RegexIterator)->Range(1 << 10, 1 << 16);
+
+} // namespace
+
+BENCHMARK_MAIN();
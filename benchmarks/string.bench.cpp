@@ -3,6 +3,7 @@
 #include <new>
 #include <vector>
 
+#include "AllocationCounter.hpp"
 #include "CartesianBenchmarks.hpp"
 #include "GenerateInput.hpp"
 #include "benchmark/benchmark.h"
@@ -49,6 +50,98 @@ static void BM_StringFindMatch2(benchmark::State &state) {
 }
 BENCHMARK(BM_StringFindMatch2)->Range(1, MAX_STRING_LEN / 4);
 
+// Benchmark repetitive text, where every position matches all but the last
+// character of the pattern.
+static void BM_StringFindRepetitive(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, 'a');
+  std::string s2(state.range(0), 'a');
+  s2 += 'b';
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindRepetitive)->Range(4, MAX_STRING_LEN / 4);
+
+// Same, with the mismatch in the middle of the pattern, which the last
+// character check does not catch.
+static void BM_StringFindRepetitiveMiddle(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, 'a');
+  std::string s2(state.range(0), 'a');
+  s2 += 'b' + s2;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindRepetitiveMiddle)->Range(4, MAX_STRING_LEN / 4);
+
+static void BM_StringRFindRepetitive(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, 'a');
+  std::string s2(state.range(0), 'a');
+  s2 = 'b' + s2;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.rfind(s2));
+}
+BENCHMARK(BM_StringRFindRepetitive)->Range(4, MAX_STRING_LEN / 4);
+
+// Benchmark the set searches on text with no character from the set.
+static void BM_StringFindFirstOf(benchmark::State &state) {
+  std::string s1(state.range(0), 'x');
+  std::string s2 = " \t\r\n,;";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find_first_of(s2));
+}
+BENCHMARK(BM_StringFindFirstOf)->Range(16, MAX_STRING_LEN);
+
+static void BM_StringFindLastOf(benchmark::State &state) {
+  std::string s1(state.range(0), 'x');
+  std::string s2 = " \t\r\n,;";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find_last_of(s2));
+}
+BENCHMARK(BM_StringFindLastOf)->Range(16, MAX_STRING_LEN);
+
+static void BM_StringFindFirstNotOf(benchmark::State &state) {
+  std::string s1(state.range(0), 'x');
+  std::string s2 = "abcdefghijklmnopqrstuvwxyz";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find_first_not_of(s2));
+}
+BENCHMARK(BM_StringFindFirstNotOf)->Range(16, MAX_STRING_LEN);
+
+// Hash a rotating set of keys of one length, so that the benchmark measures
+// throughput rather than the latency of a single hash.
+template <class Hash>
+static void BM_StringHash(benchmark::State &state, Hash hash) {
+  const std::size_t Len = state.range(0);
+  std::vector<std::string> Keys;
+  for (std::size_t I = 0; I < 64; ++I)
+    Keys.push_back(getRandomString(Len));
+  std::size_t I = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hash(Keys[I]));
+    I = (I + 1) & 63;
+  }
+  state.SetBytesProcessed(state.iterations() * Len);
+}
+
+static std::size_t defaultStringHash(const std::string& S) {
+  return std::hash<std::string>()(S);
+}
+BENCHMARK_CAPTURE(BM_StringHash, std_hash, defaultStringHash)
+    ->RangeMultiplier(2)->Range(1, 1 << 12)->Arg(24)->Arg(48);
+
+#ifdef _LIBCPP_VERSION
+// Both string hashes, whichever one _LIBCPP_ABI_FAST_STRING_HASH selects.
+static std::size_t murmur2OrCityHash(const std::string& S) {
+  return std::__murmur2_or_cityhash<std::size_t>()(S.data(), S.size());
+}
+static std::size_t xxhash32OrWyhash(const std::string& S) {
+  return std::__xxhash32_or_wyhash<std::size_t>()(S.data(), S.size());
+}
+BENCHMARK_CAPTURE(BM_StringHash, murmur2_or_cityhash, murmur2OrCityHash)
+    ->RangeMultiplier(2)->Range(1, 1 << 12)->Arg(24)->Arg(48);
+BENCHMARK_CAPTURE(BM_StringHash, xxhash32_or_wyhash, xxhash32OrWyhash)
+    ->RangeMultiplier(2)->Range(1, 1 << 12)->Arg(24)->Arg(48);
+#endif
+
 static void BM_StringCtorDefault(benchmark::State &state) {
   for (auto _ : state) {
     std::string Default;
@@ -57,6 +150,34 @@ static void BM_StringCtorDefault(benchmark::State &state) {
 }
 BENCHMARK(BM_StringCtorDefault);
 
+// Format a rotating set of random values, so that the benchmark does not
+// measure a single well-predicted digit count.
+template <class IntT>
+static void BM_ToString(benchmark::State &state) {
+  std::vector<IntT> in = getRandomIntegerInputs<IntT>(1024);
+  std::size_t I = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::to_string(in[I]));
+    I = (I + 1) & 1023;
+  }
+}
+BENCHMARK_TEMPLATE(BM_ToString, int);
+BENCHMARK_TEMPLATE(BM_ToString, unsigned);
+BENCHMARK_TEMPLATE(BM_ToString, long long);
+BENCHMARK_TEMPLATE(BM_ToString, unsigned long long);
+
+template <class IntT>
+static void BM_ToWString(benchmark::State &state) {
+  std::vector<IntT> in = getRandomIntegerInputs<IntT>(1024);
+  std::size_t I = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::to_wstring(in[I]));
+    I = (I + 1) & 1023;
+  }
+}
+BENCHMARK_TEMPLATE(BM_ToWString, int);
+BENCHMARK_TEMPLATE(BM_ToWString, unsigned long long);
+
 enum class Length { Empty, Small, Large, Huge };
 struct AllLengths : EnumValuesAsTuple<AllLengths, Length, 4> {
   static constexpr const char* Names[] = {"Empty", "Small", "Large", "Huge"};
@@ -137,10 +258,12 @@ TEST_ALWAYS_INLINE std::string makeString(Length L,
 template <class Length, class Opaque>
 struct StringConstructDestroyCStr {
   static void run(benchmark::State& state) {
+    const std::size_t Before = allocationCount();
     for (auto _ : state) {
       benchmark::DoNotOptimize(
           makeString(Length(), DiffType::Control, Opaque()));
     }
+    reportAllocations(state, Before);
   }
 
   static std::string name() {
@@ -154,6 +277,7 @@ static void StringCopyAndDestroy(benchmark::State& state) {
   auto Orig = makeString(Length());
   std::aligned_storage<sizeof(std::string)>::type Storage[NumStrings];
 
+  const std::size_t Before = allocationCount();
   while (state.KeepRunningBatch(NumStrings)) {
     if (!MeasureCopy)
       state.PauseTiming();
@@ -171,6 +295,8 @@ static void StringCopyAndDestroy(benchmark::State& state) {
     if (!MeasureDestroy)
       state.ResumeTiming();
   }
+  if (MeasureCopy)
+    reportAllocations(state, Before);
 }
 
 template <class Length>
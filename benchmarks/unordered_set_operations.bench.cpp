@@ -4,6 +4,17 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#if defined(__has_include)
+#if __has_include(<experimental/flat_hash_set>)
+#include <experimental/flat_hash_set>
+#define HAS_FLAT_HASH_SET
+#endif
+#if __has_include(<experimental/node_pool_allocator>)
+#include <experimental/node_pool_allocator>
+#define HAS_NODE_POOL_ALLOCATOR
+#endif
+#endif
 
 #include "benchmark/benchmark.h"
 
@@ -104,6 +115,33 @@ struct UInt64Hash2 {
   }
 };
 
+struct PointerTarget {
+  int value;
+};
+
+// Models the constant hash that genericjs used to return for every pointer.
+struct ConstantPointerHash {
+  ConstantPointerHash() = default;
+  inline TEST_ALWAYS_INLINE
+  std::size_t operator()(const PointerTarget*) const {
+      return 0;
+  }
+};
+
+// Every key points to a separately allocated object, which is the common
+// case for pointer-keyed maps and the worst case for genericjs, where
+// pointer identity comes from the object rather than from an address.
+inline std::vector<PointerTarget*> getRandomPointerInputs(size_t N) {
+    static std::vector<std::unique_ptr<PointerTarget>> targets;
+    while (targets.size() < N)
+        targets.emplace_back(new PointerTarget{static_cast<int>(targets.size())});
+    std::vector<PointerTarget*> inputs;
+    for (size_t i=0; i < N; ++i)
+        inputs.push_back(targets[i].get());
+    std::shuffle(inputs.begin(), inputs.end(), getRandomEngine());
+    return inputs;
+}
+
 //----------------------------------------------------------------------------//
 //                               BM_Hash
 // ---------------------------------------------------------------------------//
@@ -142,6 +180,11 @@ BENCHMARK_CAPTURE(BM_Hash,
     UInt32Hash{},
     getSortedTopBitsIntegerInputs<uint32_t>) -> Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(BM_Hash,
+    pointer_random_std_hash,
+    std::hash<PointerTarget*>{},
+    getRandomPointerInputs) -> Arg(TestNumInputs);
+
 
 //----------------------------------------------------------------------------//
 //                       BM_InsertValue
@@ -181,6 +224,17 @@ BENCHMARK_CAPTURE(BM_InsertValueRehash,
     std::unordered_set<std::string>{},
     getRandomStringInputs)->Arg(TestNumInputs);
 
+// Pointer //
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_pointer,
+    std::unordered_set<PointerTarget*>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_pointer_constant_hash,
+    std::unordered_set<PointerTarget*, ConstantPointerHash>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
 //----------------------------------------------------------------------------//
 //                         BM_Find
 // ---------------------------------------------------------------------------//
@@ -266,6 +320,17 @@ BENCHMARK_CAPTURE(BM_FindRehash,
     std::unordered_set<std::string>{},
     getRandomStringInputs)->Arg(TestNumInputs);
 
+// Pointer //
+BENCHMARK_CAPTURE(BM_Find,
+    unordered_set_pointer,
+    std::unordered_set<PointerTarget*>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    unordered_set_pointer_constant_hash,
+    std::unordered_set<PointerTarget*, ConstantPointerHash>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
 ///////////////////////////////////////////////////////////////////////////////
 BENCHMARK_CAPTURE(BM_InsertDuplicate,
     unordered_set_int,
@@ -304,4 +369,123 @@ BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
     std::unordered_set<std::string>{},
     getRandomCStringInputs)->Arg(TestNumInputs);
 
+//----------------------------------------------------------------------------//
+//                       BM_EraseInsertChurn
+// ---------------------------------------------------------------------------//
+
+BENCHMARK_CAPTURE(BM_EraseInsertChurn,
+    unordered_set_uint64,
+    std::unordered_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseInsertChurn,
+    unordered_set_string,
+    std::unordered_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+// The same churn with nodes recycled by a pool instead of going back to
+// malloc.
+#ifdef HAS_NODE_POOL_ALLOCATOR
+template <class T>
+using PooledUnorderedSet =
+    std::unordered_set<T, std::hash<T>, std::equal_to<T>,
+                       std::experimental::node_pool_allocator<T> >;
+
+BENCHMARK_CAPTURE(BM_EraseInsertChurn,
+    unordered_set_pooled_uint64,
+    PooledUnorderedSet<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseInsertChurn,
+    unordered_set_pooled_string,
+    PooledUnorderedSet<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_pooled_uint32,
+    PooledUnorderedSet<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+#endif
+
+//----------------------------------------------------------------------------//
+//                       flat_hash_set
+// ---------------------------------------------------------------------------//
+
+// The open-addressing table against the node-based one, on the same inputs
+// and hashes as above.
+#ifdef HAS_FLAT_HASH_SET
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_uint32,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_uint32_sorted,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValueRehash,
+    flat_hash_set_top_bits_uint32,
+    std::experimental::flat_hash_set<uint32_t, UInt32Hash>{},
+    getSortedTopBitsIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_pointer,
+    std::experimental::flat_hash_set<PointerTarget*>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_random_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_FindRehash,
+    flat_hash_set_random_uint64,
+    std::experimental::flat_hash_set<uint64_t, UInt64Hash>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_sorted_uint32,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_top_bits_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getSortedTopBitsIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_pointer,
+    std::experimental::flat_hash_set<PointerTarget*>{},
+    getRandomPointerInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertDuplicate,
+    flat_hash_set_int,
+    std::experimental::flat_hash_set<int>{},
+    getRandomIntegerInputs<int>)->Arg(TestNumInputs);
+BENCHMARK_CAPTURE(BM_InsertDuplicate,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
+    flat_hash_set_int,
+    std::experimental::flat_hash_set<int>{},
+    getRandomIntegerInputs<int>)->Arg(TestNumInputs);
+BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
+    flat_hash_set_string_arg,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomCStringInputs)->Arg(TestNumInputs);
+#endif
+
 BENCHMARK_MAIN();
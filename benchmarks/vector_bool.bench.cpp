@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "CartesianBenchmarks.hpp"
+#include "benchmark/benchmark.h"
+#include "test_macros.h"
+
+namespace {
+
+std::vector<bool> makeBits(size_t N, unsigned Density) {
+  std::vector<bool> V(N);
+  uint32_t Seed = 1;
+  for (size_t I = 0; I < N; ++I) {
+    Seed = Seed * 1103515245u + 12345u;
+    V[I] = (Seed >> 16) % Density == 0;
+  }
+  return V;
+}
+
+enum class Operation { And, Xor, Not, FindFirstOf, Equal };
+
+struct AllOperations : EnumValuesAsTuple<AllOperations, Operation, 5> {
+  static constexpr const char* Names[] = {"And", "Xor", "Not", "FindFirstOf",
+                                          "Equal"};
+};
+
+enum class Alignment { Aligned, Unaligned };
+
+struct AllAlignments : EnumValuesAsTuple<AllAlignments, Alignment, 2> {
+  static constexpr const char* Names[] = {"Aligned", "Unaligned"};
+};
+
+template <class Op, class Align>
+struct VectorBoolAlgorithm {
+  size_t Size;
+  VectorBoolAlgorithm(size_t S) : Size(S) {}
+
+  void run(benchmark::State& State) const {
+    // The unaligned case starts the inputs and the output at different bit
+    // offsets within their words.
+    const size_t Off = Align() == Alignment::Aligned ? 0 : 1;
+    std::vector<bool> A = makeBits(Size + 64, 2);
+    std::vector<bool> B = makeBits(Size + 64, 3);
+    std::vector<bool> Out(Size + 64);
+    const std::vector<bool> Zeros(Size + 64);
+    auto First1 = A.cbegin() + Off;
+    auto Last1 = First1 + Size;
+    auto First2 = B.cbegin() + 2 * Off;
+    auto Result = Out.begin() + 3 * Off;
+    const bool Needle[] = {true};
+    while (State.KeepRunningBatch(Size)) {
+      switch (Op()) {
+      case Operation::And:
+        std::transform(First1, Last1, First2, Result, std::logical_and<bool>());
+        benchmark::ClobberMemory();
+        break;
+      case Operation::Xor:
+        std::transform(First1, Last1, First2, Result, std::not_equal_to<bool>());
+        benchmark::ClobberMemory();
+        break;
+      case Operation::Not:
+        std::transform(First1, Last1, Result, std::logical_not<bool>());
+        benchmark::ClobberMemory();
+        break;
+      case Operation::FindFirstOf:
+        benchmark::DoNotOptimize(
+            std::find_first_of(Zeros.begin() + Off, Zeros.begin() + Off + Size,
+                               Needle, Needle + 1));
+        break;
+      case Operation::Equal:
+        benchmark::DoNotOptimize(std::equal(First1, Last1, First2));
+        break;
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_VectorBool" + Op::name() + Align::name() + "_" +
+           std::to_string(Size);
+  }
+};
+
+// Visits every set bit of a bitset with the given density, one set bit in
+// Density on average.
+template <size_t N>
+void BM_BitsetFindNext(benchmark::State& State) {
+  std::vector<bool> Bits = makeBits(N, State.range(0));
+  std::bitset<N> S;
+  for (size_t I = 0; I < N; ++I)
+    S[I] = Bits[I];
+  while (State.KeepRunningBatch(N)) {
+    size_t Sum = 0;
+    for (size_t I = S._Find_first(); I < N; I = S._Find_next(I))
+      Sum += I;
+    benchmark::DoNotOptimize(Sum);
+  }
+}
+
+template <size_t N>
+void BM_BitsetTestLoop(benchmark::State& State) {
+  std::vector<bool> Bits = makeBits(N, State.range(0));
+  std::bitset<N> S;
+  for (size_t I = 0; I < N; ++I)
+    S[I] = Bits[I];
+  while (State.KeepRunningBatch(N)) {
+    size_t Sum = 0;
+    for (size_t I = 0; I < N; ++I)
+      if (S[I])
+        Sum += I;
+    benchmark::DoNotOptimize(Sum);
+  }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_BitsetFindNext, 1 << 16)->Arg(2)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_BitsetTestLoop, 1 << 16)->Arg(2)->Arg(64)->Arg(4096);
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  const std::vector<size_t> Sizes{64, 1 << 12, 1 << 20};
+  makeCartesianProductBenchmark<VectorBoolAlgorithm, AllOperations,
+                                AllAlignments>(Sizes);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <string>
 
 #include "benchmark/benchmark.h"
 
@@ -28,5 +30,69 @@ BENCHMARK_CAPTURE(BM_ConstructIterIter,
   std::vector<std::string>{},
   getRandomStringInputs)->Arg(TestNumInputs);
 
+// Moves every element to a new buffer twice per iteration, so the time is
+// dominated by what a reallocation costs for the element type.
+template <class Container, class GenInputs>
+void BM_Reallocate(benchmark::State& st, Container c, GenInputs gen) {
+  auto in = gen(st.range(0));
+  for (auto& v : in)
+    c.push_back(std::move(v));
+  while (st.KeepRunningBatch(2 * c.size())) {
+    c.reserve(2 * c.size());
+    c.shrink_to_fit();
+    benchmark::DoNotOptimize(c.data());
+  }
+}
+
+// Builds a vector one element at a time, including its reallocations.
+template <class Container, class GenInputs>
+void BM_PushBackGrow(benchmark::State& st, Container, GenInputs gen) {
+  auto in = gen(st.range(0));
+  while (st.KeepRunningBatch(in.size())) {
+    Container c;
+    for (auto& v : in)
+      c.push_back(v);
+    benchmark::DoNotOptimize(c.data());
+  }
+}
+
+inline std::vector<std::string> getShortStringInputs(size_t N) {
+  std::vector<std::string> inputs;
+  for (size_t i = 0; i < N; ++i)
+    inputs.push_back(std::to_string(i));
+  return inputs;
+}
+
+inline std::vector<std::unique_ptr<int> > getUniquePtrInputs(size_t N) {
+  std::vector<std::unique_ptr<int> > inputs;
+  for (size_t i = 0; i < N; ++i)
+    inputs.emplace_back(new int(static_cast<int>(i)));
+  return inputs;
+}
+
+BENCHMARK_CAPTURE(BM_Reallocate,
+  vector_size_t,
+  std::vector<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs)->Arg(1 << 16);
+
+BENCHMARK_CAPTURE(BM_Reallocate,
+  vector_string,
+  std::vector<std::string>{},
+  getShortStringInputs)->Arg(TestNumInputs)->Arg(1 << 16);
+
+BENCHMARK_CAPTURE(BM_Reallocate,
+  vector_unique_ptr,
+  std::vector<std::unique_ptr<int> >{},
+  getUniquePtrInputs)->Arg(TestNumInputs)->Arg(1 << 16);
+
+BENCHMARK_CAPTURE(BM_PushBackGrow,
+  vector_size_t,
+  std::vector<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs)->Arg(1 << 16);
+
+BENCHMARK_CAPTURE(BM_PushBackGrow,
+  vector_string,
+  std::vector<std::string>{},
+  getShortStringInputs)->Arg(TestNumInputs)->Arg(1 << 16);
 
 BENCHMARK_MAIN();
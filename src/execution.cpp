@@ -0,0 +1,140 @@
+//===------------------------- execution.cpp ------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "__parallel_backend"
+
+#if defined(_LIBCPP_PAR_BACKEND_THREAD)
+
+#include "__threading_support"
+#include "thread"
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace __par_backend
+{
+
+namespace
+{
+
+// Workers sleep on work_cv until a job has chunks left to claim.  The thread
+// that submitted the job claims chunks as well, then waits on done_cv for the
+// ones still running elsewhere.  Only one job runs at a time: a submission
+// that finds the pool busy (including one made from inside a chunk) runs its
+// chunks inline instead.
+class thread_pool
+{
+    __libcpp_mutex_t submit_ = _LIBCPP_MUTEX_INITIALIZER;
+    __libcpp_mutex_t mut_ = _LIBCPP_MUTEX_INITIALIZER;
+    __libcpp_condvar_t work_cv_ = _LIBCPP_CONDVAR_INITIALIZER;
+    __libcpp_condvar_t done_cv_ = _LIBCPP_CONDVAR_INITIALIZER;
+
+    void (*fn_)(void*, size_t) = nullptr;
+    void* ctx_ = nullptr;
+    size_t count_ = 0;
+    size_t next_ = 0;
+    size_t pending_ = 0;
+    unsigned threads_;
+
+public:
+    thread_pool()
+    {
+        unsigned n = thread::hardware_concurrency();
+        threads_ = 1;
+        for (; threads_ < n; ++threads_)
+        {
+            __libcpp_thread_t t;
+            if (__libcpp_thread_create(&t, &worker, this) != 0)
+                break;
+            __libcpp_thread_detach(&t);
+        }
+    }
+
+    unsigned concurrency() const { return threads_; }
+
+    void run(size_t count, void (*fn)(void*, size_t), void* ctx)
+    {
+        if (threads_ == 1 || !__libcpp_mutex_trylock(&submit_))
+        {
+            for (size_t i = 0; i != count; ++i)
+                fn(ctx, i);
+            return;
+        }
+        __libcpp_mutex_lock(&mut_);
+        fn_ = fn;
+        ctx_ = ctx;
+        count_ = count;
+        next_ = 0;
+        pending_ = count;
+        __libcpp_condvar_broadcast(&work_cv_);
+        drain();
+        while (pending_ != 0)
+            __libcpp_condvar_wait(&done_cv_, &mut_);
+        fn_ = nullptr;
+        ctx_ = nullptr;
+        __libcpp_mutex_unlock(&mut_);
+        __libcpp_mutex_unlock(&submit_);
+    }
+
+private:
+    // Runs chunks of the current job until none are left to claim.  Called
+    // and returns with mut_ held.
+    void drain()
+    {
+        while (next_ < count_)
+        {
+            const size_t i = next_++;
+            void (*fn)(void*, size_t) = fn_;
+            void* ctx = ctx_;
+            __libcpp_mutex_unlock(&mut_);
+            fn(ctx, i);
+            __libcpp_mutex_lock(&mut_);
+            if (--pending_ == 0)
+                __libcpp_condvar_signal(&done_cv_);
+        }
+    }
+
+    static void* worker(void* p)
+    {
+        thread_pool* pool = static_cast<thread_pool*>(p);
+        __libcpp_mutex_lock(&pool->mut_);
+        for (;;)
+        {
+            while (pool->next_ >= pool->count_)
+                __libcpp_condvar_wait(&pool->work_cv_, &pool->mut_);
+            pool->drain();
+        }
+        return nullptr;
+    }
+};
+
+thread_pool& pool()
+{
+    // Never destroyed: the workers outlive static destruction.
+    static thread_pool* p = new thread_pool;
+    return *p;
+}
+
+}  // namespace
+
+unsigned
+__concurrency() _NOEXCEPT
+{
+    return pool().concurrency();
+}
+
+void
+__run(size_t count, void (*fn)(void*, size_t), void* ctx)
+{
+    pool().run(count, fn, ctx);
+}
+
+}  // namespace __par_backend
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif  // _LIBCPP_PAR_BACKEND_THREAD
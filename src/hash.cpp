@@ -568,4 +568,30 @@ next:
     }
 }
 
+#if defined(__CHEERP__) && !defined(__ASMJS__)
+
+namespace {
+
+size_t __cheerp_last_object_id = 0;
+
+} // namespace
+
+size_t
+__cheerp_object_id(const client::Object* __o) _NOEXCEPT
+{
+    size_t __id;
+    __asm__("%1.__cxx_oid|0" : "=r"(__id) : "r"(__o));
+    if (__id == 0)
+    {
+        // Ids start from 1, 0 is reserved to mark untagged objects. The
+        // property is non-enumerable so it does not leak into JS code
+        // inspecting the object.
+        __id = ++__cheerp_last_object_id;
+        __asm__("Object.defineProperty(%0,'__cxx_oid',{value:%1})" : : "r"(__o), "r"(__id));
+    }
+    return __id;
+}
+
+#endif  // defined(__CHEERP__) && !defined(__ASMJS__)
+
 _LIBCPP_END_NAMESPACE_STD
@@ -120,4 +120,33 @@ ios_base::Init::~Init()
     wclog_ptr->flush();
 }
 
+// Unsynchronized, cin and cout read ahead and collect output in buffers of
+// their own instead of going through stdio for every character.  cerr stays
+// unbuffered.  The buffers are allocated on first use and kept, since
+// output may still be pending in them when the streams are destroyed.
+bool
+ios_base::sync_with_stdio(bool sync)
+{
+    static bool previous_state = true;
+    bool r = previous_state;
+    if (sync == previous_state)
+        return r;
+    previous_state = sync;
+#ifndef _LIBCPP_HAS_NO_STDIN
+    static char* cin_buf = nullptr;
+    if (!sync && cin_buf == nullptr)
+        cin_buf = new (nothrow) char[__unsync_buffer_size];
+    if (cin_buf != nullptr)
+        __cin.__set_buffer(sync ? nullptr : cin_buf, __unsync_buffer_size);
+#endif
+#ifndef _LIBCPP_HAS_NO_STDOUT
+    static char* cout_buf = nullptr;
+    if (!sync && cout_buf == nullptr)
+        cout_buf = new (nothrow) char[__unsync_buffer_size];
+    if (cout_buf != nullptr)
+        __cout.__set_buffer(sync ? nullptr : cout_buf, __unsync_buffer_size);
+#endif
+    return r;
+}
+
 _LIBCPP_END_NAMESPACE_STD
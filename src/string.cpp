@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "string"
+#include "charconv"
 #include "cstdlib"
 #include "cwchar"
 #include "cerrno"
@@ -391,31 +392,57 @@ struct initial_string<string, V, b>
 };
 
 template <class V>
-struct initial_string<wstring, V, false>
+struct initial_string<wstring, V, true>
 {
     wstring
     operator()() const
     {
-        const size_t n = (numeric_limits<unsigned long long>::digits / 3)
-          + ((numeric_limits<unsigned long long>::digits % 3) != 0)
-          + 1;
-        wstring s(n, wchar_t());
+        wstring s(20, wchar_t());
         s.resize(s.capacity());
         return s;
     }
 };
 
+// Integers don't need the printf machinery: format them with the digit-pair
+// kernels from charconv.cpp into a buffer large enough for any value of V.
+
 template <class V>
-struct initial_string<wstring, V, true>
+inline
+typename make_unsigned<V>::type
+magnitude(char*& p, V v, true_type)
 {
-    wstring
-    operator()() const
+    typedef typename make_unsigned<V>::type U;
+    if (v < 0)
     {
-        wstring s(20, wchar_t());
-        s.resize(s.capacity());
-        return s;
+        *p++ = '-';
+        return static_cast<U>(U(0) - static_cast<U>(v));
     }
-};
+    return static_cast<U>(v);
+}
+
+template <class V>
+inline
+V
+magnitude(char*&, V v, false_type)
+{
+    return v;
+}
+
+template <class S, class V>
+inline
+S
+i_to_string(V v)
+{
+    // digits10 is one less than the number of digits of the largest value,
+    // plus one character for the sign
+    char buf[numeric_limits<V>::digits10 + 2];
+    char* p = buf;
+    typename make_unsigned<V>::type u = magnitude(p, v, is_signed<V>());
+    char* e = sizeof(u) <= sizeof(uint32_t)
+                  ? __itoa::__u32toa(static_cast<uint32_t>(u), p)
+                  : __itoa::__u64toa(static_cast<uint64_t>(u), p);
+    return S(buf, e);
+}
 
 typedef int (*wide_printf)(wchar_t* __restrict, size_t, const wchar_t*__restrict, ...);
 
@@ -434,32 +461,32 @@ get_swprintf()
 
 string to_string(int val)
 {
-    return as_string(snprintf, initial_string<string, int>()(), "%d", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(unsigned val)
 {
-    return as_string(snprintf, initial_string<string, unsigned>()(), "%u", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(long val)
 {
-    return as_string(snprintf, initial_string<string, long>()(), "%ld", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(unsigned long val)
 {
-    return as_string(snprintf, initial_string<string, unsigned long>()(), "%lu", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(long long val)
 {
-    return as_string(snprintf, initial_string<string, long long>()(), "%lld", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(unsigned long long val)
 {
-    return as_string(snprintf, initial_string<string, unsigned long long>()(), "%llu", val);
+    return i_to_string<string>(val);
 }
 
 string to_string(float val)
@@ -479,32 +506,32 @@ string to_string(long double val)
 
 wstring to_wstring(int val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, int>()(), L"%d", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(unsigned val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, unsigned>()(), L"%u", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(long val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, long>()(), L"%ld", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(unsigned long val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, unsigned long>()(), L"%lu", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(long long val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, long long>()(), L"%lld", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(unsigned long long val)
 {
-    return as_string(get_swprintf(), initial_string<wstring, unsigned long long>()(), L"%llu", val);
+    return i_to_string<wstring>(val);
 }
 
 wstring to_wstring(float val)
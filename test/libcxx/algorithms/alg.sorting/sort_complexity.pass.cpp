@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// std::sort makes O(N log N) comparisons, also on the inputs that drive a
+// plain quicksort quadratic: McIlroy's adversary, which decides the values of
+// the elements while the sort is running, and a few classic patterns.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "test_macros.h"
+
+static std::size_t log2i(std::size_t n)
+{
+    std::size_t r = 0;
+    while (n > 1)
+    {
+        ++r;
+        n >>= 1;
+    }
+    return r;
+}
+
+struct Adversary
+{
+    std::vector<int>* values;
+    int gas;
+    std::size_t* candidate;
+    int* solid;
+    std::size_t* comparisons;
+
+    bool operator()(std::size_t x, std::size_t y) const
+    {
+        std::vector<int>& v = *values;
+        ++*comparisons;
+        if (v[x] == gas && v[y] == gas)
+        {
+            if (x == *candidate)
+                v[x] = (*solid)++;
+            else
+                v[y] = (*solid)++;
+        }
+        if (v[x] == gas)
+            *candidate = x;
+        else if (v[y] == gas)
+            *candidate = y;
+        return v[x] < v[y];
+    }
+};
+
+std::size_t adversary_comparisons(std::size_t n)
+{
+    std::vector<int> values(n, static_cast<int>(n));
+    std::vector<std::size_t> indices(n);
+    for (std::size_t i = 0; i != n; ++i)
+        indices[i] = i;
+    std::size_t candidate = 0;
+    int solid = 0;
+    std::size_t comparisons = 0;
+    Adversary adversary = {&values, static_cast<int>(n), &candidate, &solid, &comparisons};
+    std::sort(indices.begin(), indices.end(), adversary);
+    for (std::size_t i = 1; i != n; ++i)
+        assert(values[indices[i - 1]] <= values[indices[i]]);
+    return comparisons;
+}
+
+struct CountingLess
+{
+    std::size_t* comparisons;
+    bool operator()(int x, int y) const
+    {
+        ++*comparisons;
+        return x < y;
+    }
+};
+
+std::size_t pattern_comparisons(std::vector<int> v)
+{
+    std::size_t comparisons = 0;
+    CountingLess less = {&comparisons};
+    std::sort(v.begin(), v.end(), less);
+    assert(std::is_sorted(v.begin(), v.end()));
+    return comparisons;
+}
+
+int main(int, char**)
+{
+    const std::size_t sizes[] = {1000, 1 << 14, 100000};
+    for (std::size_t n : sizes)
+    {
+        const std::size_t bound = 3 * n * log2i(n);
+        assert(adversary_comparisons(n) <= bound);
+
+        std::vector<int> v(n);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = static_cast<int>(i < n / 2 ? i : n - i);
+        assert(pattern_comparisons(v) <= bound);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = static_cast<int>(i % 2 == 0 ? i : n - i);
+        assert(pattern_comparisons(v) <= bound);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = static_cast<int>((i * 7919) % 16);
+        assert(pattern_comparisons(v) <= bound);
+    }
+
+  return 0;
+}
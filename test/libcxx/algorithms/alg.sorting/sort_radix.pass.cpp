@@ -0,0 +1,145 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// sort and stable_sort radix sort long ranges of integral and floating point
+// values under the default ordering.  Check them against a comparison sort,
+// across the key widths and signs, and that stable_sort keeps -0.0 and 0.0 in
+// their original order.  A comparator for another type keeps its own
+// ordering.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_macros.h"
+
+std::mt19937_64 randomness;
+
+template <class T>
+struct compare
+{
+    bool operator()(T x, T y) const { return x < y; }
+};
+
+template <class T>
+void
+test_one(const std::vector<T>& v)
+{
+    std::vector<T> expected = v;
+    std::stable_sort(expected.begin(), expected.end(), compare<T>());
+
+    std::vector<T> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i != v.size(); ++i)
+        assert(!(sorted[i] < expected[i]) && !(expected[i] < sorted[i]));
+
+    sorted = v;
+    std::sort(sorted.begin(), sorted.end(), std::less<T>());
+    for (std::size_t i = 0; i != v.size(); ++i)
+        assert(!(sorted[i] < expected[i]) && !(expected[i] < sorted[i]));
+
+    sorted = v;
+    std::stable_sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i != v.size(); ++i)
+        assert(sorted[i] == expected[i] &&
+               std::signbit(static_cast<double>(sorted[i])) == std::signbit(static_cast<double>(expected[i])));
+}
+
+template <class T>
+void
+test()
+{
+    const std::size_t sizes[] = {0, 1, 63, 64, 65, 500, 1000, 4096, 10007};
+    for (std::size_t n : sizes)
+    {
+        std::vector<T> v(n);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = static_cast<T>(randomness());
+        test_one(v);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = static_cast<T>(static_cast<int>(randomness() % 7) - 3);
+        test_one(v);
+        for (std::size_t i = 0; i != n; ++i)
+            v[i] = i % 3 == 0 ? std::numeric_limits<T>::max()
+                 : i % 3 == 1 ? std::numeric_limits<T>::lowest() : T(0);
+        test_one(v);
+    }
+}
+
+void
+test_signed_zero()
+{
+    std::vector<double> v;
+    for (int i = 0; i != 3000; ++i)
+        v.push_back(i % 3 == 0 ? 1.5 : i % 3 == 1 ? -0.0 : 0.0);
+    std::vector<double> sorted = v;
+    std::stable_sort(sorted.begin(), sorted.end());
+    std::size_t j = 0;
+    for (int i = 0; i != 3000; ++i)
+    {
+        if (v[i] == 0)
+        {
+            assert(sorted[j] == 0 && std::signbit(sorted[j]) == std::signbit(v[i]));
+            ++j;
+        }
+    }
+    assert(j == 2000);
+}
+
+void
+test_other_comparator()
+{
+    std::vector<int> v;
+    for (int i = 0; i != 5000; ++i)
+        v.push_back(static_cast<int>(randomness() % 2001) - 1000);
+    std::vector<int> expected = v;
+    std::stable_sort(expected.begin(), expected.end(), compare<unsigned>());
+
+    std::vector<int> sorted = v;
+    std::sort(sorted.begin(), sorted.end(), std::less<unsigned>());
+    assert(sorted == expected);
+    assert(sorted.front() >= 0 && sorted.back() < 0);
+
+    sorted = v;
+    std::stable_sort(sorted.begin(), sorted.end(), std::less<unsigned>());
+    assert(sorted == expected);
+#if TEST_STD_VER > 11
+    sorted = v;
+    std::sort(sorted.begin(), sorted.end(), std::less<>());
+    std::stable_sort(expected.begin(), expected.end(), compare<int>());
+    assert(sorted == expected);
+#endif
+}
+
+int main(int, char**)
+{
+    test<char>();
+    test<signed char>();
+    test<unsigned char>();
+    test<short>();
+    test<unsigned short>();
+    test<int>();
+    test<unsigned>();
+    test<long>();
+    test<unsigned long>();
+    test<long long>();
+    test<unsigned long long>();
+    test<float>();
+    test<double>();
+    test_signed_zero();
+    test_other_comparator();
+
+  return 0;
+}
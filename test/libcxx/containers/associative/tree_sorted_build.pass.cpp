@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// Not a portable test
+
+// Inserting a range into an empty __tree links the sorted prefix of the range
+// directly into a balanced red-black tree.
+
+#include <__tree>
+#include <algorithm>
+#include <map>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "test_iterators.h"
+
+typedef std::__tree<int, std::less<int>, std::allocator<int> > Tree;
+
+template <class Iter>
+void check(Iter first, Iter last, bool unique)
+{
+    std::vector<int> expected(first.base(), last.base());
+    std::sort(expected.begin(), expected.end());
+    if (unique)
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+    Tree t((std::less<int>()));
+    if (unique)
+        t.__insert_unique_range(first, last);
+    else
+        t.__insert_multi_range(first, last);
+    const Tree& ct = t;
+    assert(ct.size() == expected.size());
+    assert(ct.__root() == nullptr || std::__tree_invariant(ct.__root()));
+    std::vector<int>::const_iterator e = expected.begin();
+    for (Tree::const_iterator i = ct.begin(); i != ct.end(); ++i, ++e)
+        assert(*i == *e);
+    assert(e == expected.end());
+}
+
+void check_all(const std::vector<int>& v)
+{
+    typedef forward_iterator<const int*> F;
+    const int* first = v.data();
+    const int* last = first + v.size();
+    check(F(first), F(last), true);
+    check(F(first), F(last), false);
+    check(input_iterator<const int*>(first), input_iterator<const int*>(last), true);
+    check(input_iterator<const int*>(first), input_iterator<const int*>(last), false);
+}
+
+int main(int, char**)
+{
+    for (int n = 0; n < 70; ++n)
+    {
+        std::vector<int> v;
+        for (int i = 0; i < n; ++i)
+            v.push_back(i);
+        check_all(v);
+        for (int i = 0; i < n; ++i)
+            v[i] = i / 3;
+        check_all(v);
+        for (int i = 0; i < n; ++i)
+            v[i] = i < n / 2 ? i : n - i;
+        check_all(v);
+    }
+    {
+        std::vector<int> v;
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i * 7 % 1000 < 500 ? i : 1000 - i);
+        check_all(v);
+    }
+    {
+        // Equivalent elements keep the order of the range.
+        typedef std::pair<int, int> P;
+        P a[] = {P(1, 0), P(1, 1), P(2, 2), P(2, 3), P(2, 4), P(3, 5), P(0, 6), P(1, 7)};
+        std::multimap<int, int> m(a, a + sizeof(a) / sizeof(a[0]));
+        int expected[] = {6, 0, 1, 7, 2, 3, 4, 5};
+        int i = 0;
+        for (std::multimap<int, int>::iterator it = m.begin(); it != m.end(); ++it, ++i)
+            assert(it->second == expected[i]);
+        std::map<int, int> u(a, a + sizeof(a) / sizeof(a[0]));
+        assert(u.size() == 4);
+        assert(u[0] == 6 && u[1] == 0 && u[2] == 2 && u[3] == 5);
+    }
+
+  return 0;
+}
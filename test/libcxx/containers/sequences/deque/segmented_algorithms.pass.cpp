@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deque>
+
+// deque iterators are segmented iterators, and the algorithms that handle
+// them block by block give the same results as element by element.
+
+#include <deque>
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "test_macros.h"
+#include "min_allocator.h"
+
+struct Sum
+{
+    long long* s;
+    explicit Sum(long long* p) : s(p) {}
+    void operator()(int x) const {*s += x;}
+};
+
+struct Equals
+{
+    int k;
+    explicit Equals(int x) : k(x) {}
+    bool operator()(int x) const {return x == k;}
+};
+
+struct IsEven
+{
+    bool operator()(int x) const {return x % 2 == 0;}
+};
+
+struct Subtract
+{
+    long long operator()(long long a, int b) const {return a - b;}
+};
+
+template <class D>
+void test_range(D& d, int first, int last)
+{
+    typedef typename D::iterator I;
+    typedef typename D::const_iterator CI;
+    I f = d.begin() + first;
+    I l = d.begin() + last;
+    CI cf = f;
+    CI cl = l;
+    long long expected = 0;
+    for (int i = first; i < last; ++i)
+        expected += d[i];
+
+    assert(std::accumulate(cf, cl, 0LL) == expected);
+    assert(std::accumulate(f, l, 0LL, Subtract()) == -expected);
+    long long s = 0;
+    std::for_each(f, l, Sum(&s));
+    assert(s == expected);
+
+    const int keys[] = {first - 1, first, (first + last) / 2, last - 1, last};
+    for (int i = 0; i < 5; ++i)
+    {
+        int k = keys[i];
+        int pos = k >= first && k < last ? k : last;
+        assert(std::find(cf, cl, k) - d.cbegin() == pos);
+        assert(std::find_if(f, l, Equals(k)) - d.begin() == pos);
+        assert(std::count(f, l, k) == (pos != last));
+    }
+    assert(std::count_if(cf, cl, IsEven()) == (last + 1) / 2 - (first + 1) / 2);
+}
+
+template <class D>
+void test()
+{
+    const int sizes[] = {0, 1, 2, 1023, 1024, 1025, 3000};
+    const int offsets[] = {0, 1, 1000};
+    for (int i = 0; i < 7; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            int n = sizes[i];
+            D d;
+            for (int k = 0; k < offsets[j]; ++k)
+                d.push_front(-1);
+            for (int k = 0; k < n; ++k)
+                d.push_back(k);
+            d.erase(d.begin(), d.begin() + offsets[j]);
+
+            test_range(d, 0, n);
+            test_range(d, n / 3, n - n / 3);
+            test_range(d, n / 2, n / 2);
+
+            std::fill(d.begin() + n / 3, d.end() - n / 3, -2);
+            for (int k = 0; k < n; ++k)
+                assert(d[k] == (k >= n / 3 && k < n - n / 3 ? -2 : k));
+            std::fill(d.begin(), d.end(), 5);
+            assert(std::count(d.begin(), d.end(), 5) == n);
+            assert(d.__invariants());
+        }
+    }
+}
+
+int main()
+{
+    static_assert(std::__is_segmented_iterator<std::deque<int>::iterator>::value, "");
+    static_assert(std::__is_segmented_iterator<std::deque<int>::const_iterator>::value, "");
+    static_assert(!std::__is_segmented_iterator<std::deque<int>::reverse_iterator>::value, "");
+    static_assert(!std::__is_segmented_iterator<int*>::value, "");
+
+    test<std::deque<int> >();
+#if TEST_STD_VER >= 11
+    test<std::deque<int, min_allocator<int> > >();
+#endif
+}
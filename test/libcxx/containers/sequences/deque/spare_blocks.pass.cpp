@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deque>
+
+// Spare blocks are kept for reuse at both ends, and the block size can be
+// set for a user-defined type through experimental::deque_block_size.
+
+#include <deque>
+#include <experimental/deque>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+
+#include "test_macros.h"
+
+static int allocations = 0;
+
+template <class T>
+struct counting_allocator
+{
+    typedef T value_type;
+
+    counting_allocator() {}
+    template <class U> counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        return static_cast<T*>(std::malloc(n * sizeof(T)));
+    }
+    void deallocate(T* p, std::size_t) {std::free(p);}
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) {return true;}
+    friend bool operator!=(const counting_allocator&, const counting_allocator&) {return false;}
+};
+
+struct Small
+{
+    int v;
+    Small(int x = 0) : v(x) {}
+};
+
+namespace std { namespace experimental {
+template <>
+struct deque_block_size<Small> : std::integral_constant<std::ptrdiff_t, 3> {};
+}}
+
+template <class D>
+void fill_and_drain(D& d, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        d.push_back(typename D::value_type(static_cast<int>(i)));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert(d.front().v == static_cast<int>(i));
+        d.pop_front();
+    }
+    for (std::size_t i = 0; i < n; ++i)
+        d.push_front(typename D::value_type(static_cast<int>(i)));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert(d.back().v == static_cast<int>(i));
+        d.pop_back();
+    }
+    assert(d.__invariants());
+}
+
+template <class T>
+void test_fill_and_drain(std::size_t n)
+{
+    std::deque<T, counting_allocator<T> > d;
+    fill_and_drain(d, n);
+    int before = allocations;
+    for (int round = 0; round < 10; ++round)
+        fill_and_drain(d, n);
+    assert(allocations == before);
+}
+
+struct Int
+{
+    int v;
+    Int(int x) : v(x) {}
+};
+
+int main()
+{
+    static_assert(std::experimental::deque_block_size<Small>::value == 3, "");
+    static_assert(std::experimental::deque_block_size<int>::value == 1024, "");
+    LIBCPP_STATIC_ASSERT(std::__deque_block_size<Small, std::ptrdiff_t>::value == 3, "");
+    {
+        // Blocks of three elements: every push and pop crosses a block often.
+        std::deque<Small> d;
+        for (int i = 0; i < 100; ++i)
+        {
+            d.push_back(Small(i));
+            d.push_front(Small(-i));
+        }
+        assert(d.size() == 200);
+        assert(d.__invariants());
+        for (int i = 0; i < 100; ++i)
+            assert(d[100 + i].v == i && d[99 - i].v == -i);
+        d.erase(d.begin() + 10, d.begin() + 50);
+        d.erase(d.end() - 50, d.end() - 10);
+        assert(d.size() == 120);
+        assert(d.__invariants());
+        d.resize(5);
+        d.shrink_to_fit();
+        assert(d.__invariants());
+        assert(d[0].v == -99 && d[4].v == -95);
+    }
+    // A queue that repeatedly grows by two blocks and drains again stops
+    // allocating after the first time.
+    test_fill_and_drain<Small>(6);
+    test_fill_and_drain<Int>(2 * std::__deque_block_size<Int, std::ptrdiff_t>::value);
+    {
+        // shrink_to_fit still returns every spare block.
+        typedef std::deque<Small, counting_allocator<Small> > D;
+        D d;
+        for (int i = 0; i < 30; ++i)
+            d.push_back(Small(i));
+        for (int i = 0; i < 29; ++i)
+            d.pop_front();
+        d.shrink_to_fit();
+        assert(d.__invariants());
+        assert(d.size() == 1 && d.front().v == 29);
+        int before = allocations;
+        d.push_back(Small(30));
+        d.push_back(Small(31));
+        d.push_back(Small(32));
+        d.push_back(Small(33));
+        assert(allocations > before);
+    }
+}
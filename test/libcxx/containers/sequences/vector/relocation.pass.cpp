@@ -0,0 +1,178 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <vector>
+
+// Trivially relocatable elements are moved to a new buffer by copying their
+// bytes, and allocators may hand out more capacity than requested or grow an
+// allocation in place.
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "test_macros.h"
+
+struct NotRelocatable
+{
+    NotRelocatable* self;
+    NotRelocatable() : self(this) {}
+    NotRelocatable(const NotRelocatable&) : self(this) {}
+    NotRelocatable& operator=(const NotRelocatable&) {return *this;}
+    ~NotRelocatable() {assert(self == this);}
+};
+
+struct Relocatable
+{
+    typedef Relocatable __trivially_relocatable;
+    int* p;
+    explicit Relocatable(int x = 0) : p(new int(x)) {}
+    Relocatable(Relocatable&& r) : p(r.p) {r.p = nullptr;}
+    Relocatable& operator=(Relocatable&& r) {std::swap(p, r.p); return *this;}
+    ~Relocatable() {delete p;}
+};
+
+static_assert(std::__libcpp_is_trivially_relocatable<int>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<Relocatable>::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<NotRelocatable>::value, "");
+static_assert(std::__allocator_relocates_trivially<std::allocator<Relocatable>, Relocatable>::value, "");
+
+// Allocates in chunks of 16 objects, and grows the last allocation in place
+// while the arena has room.
+template <class T>
+struct arena_allocator
+{
+    typedef T value_type;
+
+    struct allocation_result
+    {
+        T* ptr;
+        std::size_t count;
+    };
+
+    static const std::size_t arena_size = 1024;
+    static char arena[arena_size * sizeof(T)];
+    static std::size_t used;
+    static std::size_t last;
+    static int expansions;
+
+    arena_allocator() {}
+    template <class U> arena_allocator(const arena_allocator<U>&) {}
+
+    allocation_result allocate_at_least(std::size_t n)
+    {
+        n = (n + 15) / 16 * 16;
+        assert(used + n <= arena_size);
+        last = used;
+        used += n;
+        allocation_result r = {reinterpret_cast<T*>(arena) + last, n};
+        return r;
+    }
+    T* allocate(std::size_t n) {return allocate_at_least(n).ptr;}
+    void deallocate(T* p, std::size_t n)
+    {
+        assert(static_cast<std::size_t>(p - reinterpret_cast<T*>(arena)) + n <= used);
+    }
+    bool try_expand(T* p, std::size_t n, std::size_t new_n)
+    {
+        if (p != reinterpret_cast<T*>(arena) + last || last + n != used ||
+            last + new_n > arena_size)
+            return false;
+        used = last + new_n;
+        ++expansions;
+        return true;
+    }
+};
+
+template <class T> char arena_allocator<T>::arena[arena_size * sizeof(T)];
+template <class T> std::size_t arena_allocator<T>::used = 0;
+template <class T> std::size_t arena_allocator<T>::last = 0;
+template <class T> int arena_allocator<T>::expansions = 0;
+
+template <class T, class U>
+bool operator==(const arena_allocator<T>&, const arena_allocator<U>&) {return true;}
+template <class T, class U>
+bool operator!=(const arena_allocator<T>&, const arena_allocator<U>&) {return false;}
+
+template <class T>
+void test_growth()
+{
+    std::vector<T> v;
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(T());
+        v.insert(v.begin() + v.size() / 2, T());
+    }
+    assert(v.size() == 2000);
+    v.reserve(5000);
+    v.shrink_to_fit();
+    v.resize(3000);
+    assert(v.size() == 3000);
+}
+
+void test_relocation()
+{
+    std::vector<Relocatable> v;
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(Relocatable(i));
+    v.insert(v.begin() + 10, Relocatable(-1));
+    v.shrink_to_fit();
+    for (int i = 0; i < 1001; ++i)
+        assert(*v[i].p == (i < 10 ? i : i == 10 ? -1 : i - 1));
+
+    std::vector<std::unique_ptr<int> > u;
+    for (int i = 0; i < 1000; ++i)
+        u.emplace_back(new int(i));
+    u.reserve(4000);
+    for (int i = 0; i < 1000; ++i)
+        assert(*u[i] == i);
+
+    std::vector<std::string> s;
+    for (int i = 0; i < 1000; ++i)
+        s.push_back(std::string(i % 40, 'a'));
+    s.emplace(s.begin(), 100, 'b');
+    assert(s[0] == std::string(100, 'b'));
+    for (int i = 0; i < 1000; ++i)
+        assert(s[i + 1] == std::string(i % 40, 'a'));
+}
+
+void test_allocator_extensions()
+{
+    typedef arena_allocator<int> A;
+    std::vector<int, A> v;
+    v.push_back(0);
+    assert(v.capacity() == 16);
+    for (int i = 1; i < 100; ++i)
+        v.push_back(i);
+    assert(v.capacity() >= 100);
+    assert(A::expansions > 0);
+    assert(A::used == v.capacity());
+    for (int i = 0; i < 100; ++i)
+        assert(v[i] == i);
+
+    std::vector<int, A> w(3);
+    assert(w.capacity() == 16);
+    v.resize(200, 7);
+    assert(v[150] == 7);
+    assert(v.capacity() >= 200);
+}
+
+int main()
+{
+    test_growth<int>();
+    test_growth<NotRelocatable>();
+    test_growth<Relocatable>();
+    test_growth<std::string>();
+    test_relocation();
+    test_allocator_extensions();
+}
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Not a portable test
+
+// <__hash_table>
+
+// size_t __constrain_hash(size_t h, size_t bc, const __hash_bucket_divisor<>& d);
+
+// Returns h % bc, using the reciprocal in d when bc is not a power of two.
+
+#include <__hash_table>
+#include <cassert>
+#include <limits>
+#include <memory>
+
+std::size_t state = 88172645463325252ull & std::numeric_limits<std::size_t>::max();
+
+std::size_t
+next()
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+void
+test(std::size_t bc)
+{
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+    std::__hash_bucket_divisor<> d(bc);
+    assert(std::__constrain_hash(0, bc, d) == 0);
+    assert(std::__constrain_hash(bc - 1, bc, d) == bc - 1);
+    assert(std::__constrain_hash(bc, bc, d) == 0);
+    assert(std::__constrain_hash(max, bc, d) == max % bc);
+    assert(std::__constrain_hash(max - 1, bc, d) == (max - 1) % bc);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::size_t h = next() >> (i % std::numeric_limits<std::size_t>::digits);
+        assert(std::__constrain_hash(h, bc, d) == h % bc);
+    }
+}
+
+#ifndef _LIBCPP_ABI_HASH_BUCKET_DIVISOR
+// Without the ABI flag the bucket list does not keep the divisor.
+static_assert(sizeof(std::__bucket_list_deallocator<std::allocator<void*> >) ==
+              sizeof(std::size_t), "");
+#endif
+
+int main()
+{
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+    for (std::size_t bc = 1; bc < 5000; ++bc)
+        test(bc);
+    for (std::size_t n = 1; n < 100000; n = n * 3 + 1)
+        test(std::__next_prime(n));
+    test(max);
+    test(max - 1);
+    test(max / 2 + 2);
+    test(max / 3);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::size_t bc = next() >> (i % std::numeric_limits<std::size_t>::digits);
+        if (bc != 0)
+            test(bc);
+    }
+}
@@ -63,6 +63,7 @@
 #include <deque>
 #include <errno.h>
 #include <exception>
+#include <execution>
 #include <filesystem>
 #include <float.h>
 #include <forward_list>
@@ -145,12 +146,17 @@
 #endif
 #include <experimental/deque>
 #include <experimental/filesystem>
+#include <experimental/flat_hash_map>
+#include <experimental/flat_hash_set>
+#include <experimental/flat_map>
+#include <experimental/flat_set>
 #include <experimental/forward_list>
 #include <experimental/functional>
 #include <experimental/iterator>
 #include <experimental/list>
 #include <experimental/map>
 #include <experimental/memory_resource>
+#include <experimental/node_pool_allocator>
 #include <experimental/propagate_const>
 #include <experimental/regex>
 #include <experimental/simd>
@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// <experimental/flat_hash_map>
+
+// Check flat_hash_map against std::unordered_map under a random mix of
+// inserts and erases, and the map specific insertion and lookup functions.
+
+#include <experimental/flat_hash_map>
+#include <cassert>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "test_macros.h"
+
+namespace ex = std::experimental;
+
+void
+test_churn()
+{
+    std::mt19937 randomness;
+    ex::flat_hash_map<unsigned, unsigned> m;
+    std::unordered_map<unsigned, unsigned> ref;
+    for (unsigned i = 0; i < 50000; ++i)
+    {
+        unsigned k = randomness() % 2000;
+        if (randomness() % 3 == 0)
+            assert(m.erase(k) == ref.erase(k));
+        else
+            m[k] = ref[k] = i;
+    }
+    assert(m.size() == ref.size());
+    for (ex::flat_hash_map<unsigned, unsigned>::const_iterator i = m.begin();
+            i != m.end(); ++i)
+        assert(ref.at(i->first) == i->second);
+    for (std::unordered_map<unsigned, unsigned>::const_iterator i = ref.begin();
+            i != ref.end(); ++i)
+        assert(m.at(i->first) == i->second);
+}
+
+void
+test_map_interface()
+{
+    typedef ex::flat_hash_map<std::string, std::unique_ptr<int> > Map;
+    Map m;
+    assert(m.try_emplace("a", new int(1)).second);
+    assert(!m.try_emplace("a", nullptr).second);
+    assert(*m.at("a") == 1);
+
+    std::string key = "b";
+    assert(m.insert_or_assign(std::move(key), std::unique_ptr<int>(new int(2))).second);
+    assert(!m.insert_or_assign("b", std::unique_ptr<int>(new int(3))).second);
+    assert(*m.at("b") == 3);
+
+    assert(m.insert(std::make_pair(std::string("c"), std::unique_ptr<int>())).second);
+    assert(m.count("c") == 1 && m["c"] == nullptr);
+    assert(m["d"] == nullptr);
+    assert(m.size() == 4);
+
+    Map n(std::move(m));
+    assert(m.empty());
+    assert(n.size() == 4);
+    assert(*n.find("a")->second == 1);
+    assert(n.equal_range("z").first == n.end());
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    try
+    {
+        TEST_IGNORE_NODISCARD n.at("z");
+        assert(false);
+    }
+    catch (const std::out_of_range&)
+    {
+    }
+#endif
+}
+
+void
+test_compare()
+{
+    typedef ex::flat_hash_map<int, int> Map;
+    Map a = {{1, 10}, {2, 20}, {3, 30}};
+    Map b(a.begin(), a.end());
+    assert(a == b);
+    b[3] = 31;
+    assert(a != b);
+    b.erase(3);
+    assert(a != b);
+    b.emplace(3, 30);
+    assert(a == b);
+}
+
+int main(int, char**)
+{
+    test_churn();
+    test_map_interface();
+    test_compare();
+
+  return 0;
+}
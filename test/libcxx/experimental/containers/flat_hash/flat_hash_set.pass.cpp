@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// <experimental/flat_hash_set>
+
+// Check flat_hash_set against std::unordered_set under a random mix of
+// inserts and erases, so that probing runs across deleted slots, and that
+// rehash, copy, move and swap keep every element.
+
+#include <experimental/flat_hash_set>
+#include <cassert>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "test_macros.h"
+
+namespace ex = std::experimental;
+
+template <class Set, class Ref>
+void
+check_equal(const Set& s, const Ref& ref)
+{
+    assert(s.size() == ref.size());
+    assert(s.load_factor() <= s.max_load_factor());
+    typename Ref::size_type n = 0;
+    for (typename Set::const_iterator i = s.begin(); i != s.end(); ++i, ++n)
+        assert(ref.count(*i) == 1);
+    assert(n == ref.size());
+    for (typename Ref::const_iterator i = ref.begin(); i != ref.end(); ++i)
+        assert(s.contains(*i));
+}
+
+void
+test_churn()
+{
+    std::mt19937 randomness;
+    ex::flat_hash_set<int> s;
+    std::unordered_set<int> ref;
+    for (int i = 0; i < 50000; ++i)
+    {
+        int k = static_cast<int>(randomness() % 2000);
+        if (randomness() % 3 == 0)
+            assert(s.erase(k) == ref.erase(k));
+        else
+            assert(s.insert(k).second == ref.insert(k).second);
+    }
+    check_equal(s, ref);
+
+    // Erasing through iterators while walking the table.
+    for (ex::flat_hash_set<int>::iterator i = s.begin(); i != s.end();)
+    {
+        if (*i % 2)
+        {
+            ref.erase(*i);
+            i = s.erase(i);
+        }
+        else
+            ++i;
+    }
+    check_equal(s, ref);
+
+    s.rehash(10000);
+    assert(s.bucket_count() >= 10000);
+    check_equal(s, ref);
+
+    s.clear();
+    assert(s.empty());
+    assert(s.begin() == s.end());
+    assert(s.find(0) == s.end());
+}
+
+void
+test_copy_move_swap()
+{
+    typedef ex::flat_hash_set<std::string> Set;
+    Set s = {"one", "two", "three", "four", "five"};
+    assert(s.size() == 5);
+    assert(!s.insert("two").second);
+    assert(s.count("three") == 1);
+    assert(s.count("six") == 0);
+
+    Set c(s);
+    assert(c == s);
+    Set m(std::move(c));
+    assert(m == s);
+    assert(c.empty());
+
+    Set t = {"six"};
+    swap(t, m);
+    assert(t == s);
+    assert(m.size() == 1 && *m.begin() == "six");
+    assert(m != s);
+
+    m = s;
+    assert(m == s);
+    t = std::move(m);
+    assert(t == s);
+
+    t.erase(t.begin(), t.end());
+    assert(t.empty());
+}
+
+int main(int, char**)
+{
+    test_churn();
+    test_copy_move_swap();
+
+  return 0;
+}
@@ -0,0 +1,192 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// <experimental/flat_map>
+
+// Check flat_map and flat_multimap against map and multimap under random
+// single and bulk inserts and erases, sorted and unsorted, and that the keys
+// and mapped values stay paired.
+
+#include <experimental/flat_map>
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace ex = std::experimental;
+
+template <class Map, class Ref>
+void
+check_equal(const Map& m, const Ref& ref)
+{
+    assert(m.size() == ref.size());
+    assert(m.keys().size() == m.values().size());
+    typename Ref::const_iterator r = ref.begin();
+    for (typename Map::const_iterator i = m.begin(); i != m.end(); ++i, ++r)
+    {
+        assert(i->first == r->first);
+        assert((*i).second == r->second);
+    }
+}
+
+template <class Map, class Ref>
+void
+insert_one(Map& m, Ref& ref, int k, int v, std::true_type)
+{
+    assert(m.insert(std::make_pair(k, v)).second == ref.insert(std::make_pair(k, v)).second);
+}
+
+template <class Map, class Ref>
+void
+insert_one(Map& m, Ref& ref, int k, int v, std::false_type)
+{
+    m.insert(std::make_pair(k, v));
+    ref.insert(std::make_pair(k, v));
+}
+
+template <class Map, class Ref, class Tag, class Unique>
+void
+random_ops(Tag tag, Unique unique)
+{
+    std::mt19937 gen(7);
+    Map m;
+    Ref ref;
+    int serial = 0;
+    for (int step = 0; step < 2000; ++step)
+    {
+        int k = static_cast<int>(gen() % 200);
+        switch (gen() % 6)
+        {
+        case 0:
+            insert_one(m, ref, k, serial++, unique);
+            break;
+        case 1:
+        {
+            // A wrong hint only matters for where equal keys go.
+            int h = Unique::value ? static_cast<int>(gen() % 200) : k;
+            m.emplace_hint(m.lower_bound(h), k, serial);
+            ref.emplace_hint(ref.lower_bound(k), k, serial++);
+            break;
+        }
+        case 2:
+            assert(m.erase(k) == ref.erase(k));
+            break;
+        case 3:
+        {
+            std::vector<std::pair<int, int> > v;
+            for (unsigned n = gen() % 20; n > 0; --n)
+                v.push_back(std::make_pair(static_cast<int>(gen() % 200), serial++));
+            m.insert(v.begin(), v.end());
+            ref.insert(v.begin(), v.end());
+            break;
+        }
+        case 4:
+        {
+            Ref part;
+            for (unsigned n = gen() % 20; n > 0; --n)
+                part.insert(std::make_pair(static_cast<int>(gen() % 200), serial++));
+            m.insert(tag, part.begin(), part.end());
+            ref.insert(part.begin(), part.end());
+            break;
+        }
+        case 5:
+            if (!m.empty())
+            {
+                typename Map::size_type i = gen() % m.size();
+                typename Ref::iterator r = ref.begin();
+                std::advance(r, i);
+                ref.erase(r);
+                m.erase(m.begin() + i);
+            }
+            break;
+        }
+        check_equal(m, ref);
+    }
+    for (int k = -1; k <= 200; ++k)
+    {
+        assert(m.count(k) == ref.count(k));
+        assert(m.contains(k) == (ref.count(k) != 0));
+        assert(m.lower_bound(k) - m.begin() ==
+               std::distance(ref.begin(), ref.lower_bound(k)));
+        assert(m.upper_bound(k) - m.begin() ==
+               std::distance(ref.begin(), ref.upper_bound(k)));
+    }
+}
+
+int main(int, char**)
+{
+    random_ops<ex::flat_map<int, int>, std::map<int, int> >(ex::sorted_unique,
+                                                            std::true_type());
+    random_ops<ex::flat_multimap<int, int>, std::multimap<int, int> >(ex::sorted_equivalent,
+                                                                      std::false_type());
+    {
+        ex::flat_map<std::string, int> m;
+        m["b"] = 2;
+        m["a"] = 1;
+        assert(m.try_emplace("a", 5).second == false);
+        assert(m.insert_or_assign("c", 3).second == true);
+        assert(m.insert_or_assign("a", 4).second == false);
+        assert(m.at("a") == 4 && m["b"] == 2 && m.at("c") == 3);
+        assert(m.keys().front() == "a" && m.values().back() == 3);
+#ifndef TEST_HAS_NO_EXCEPTIONS
+        try
+        {
+            m.at("d");
+            assert(false);
+        }
+        catch (const std::out_of_range&)
+        {
+        }
+#endif
+        ex::flat_map<std::string, int>::iterator i = m.find("b");
+        i->second = 20;
+        assert(m["b"] == 20);
+        ex::flat_map<std::string, int>::const_iterator ci = i;
+        assert(ci->second == 20 && ci - m.cbegin() == 1);
+
+        ex::flat_map<std::string, int>::containers c = std::move(m).extract();
+        assert(m.empty() && c.keys.size() == 3 && c.values.size() == 3);
+        m.replace(std::move(c.keys), std::move(c.values));
+        assert(m.size() == 3);
+        ex::erase_if(m, [](ex::flat_map<std::string, int>::const_reference e) {
+            return e.second > 10;
+        });
+        assert(m.size() == 2 && !m.contains("b"));
+    }
+    {
+        // Construction from unsorted containers sorts them together and
+        // keeps the first of equal keys.
+        std::vector<int> keys = {3, 1, 2, 1};
+        std::vector<char> values = {'c', 'a', 'b', 'x'};
+        ex::flat_map<int, char> m(keys, values);
+        assert(m.size() == 3 && m[1] == 'a' && m[2] == 'b' && m[3] == 'c');
+        ex::flat_multimap<int, char> mm(keys, values);
+        assert(mm.size() == 4 && mm.count(1) == 2);
+        assert(mm.begin()->second == 'a' && (mm.begin() + 1)->second == 'x');
+
+        ex::flat_map<int, int, std::less<> > t = {{1, 1}, {2, 2}};
+        assert(t.contains(2L) && t.find(3L) == t.end());
+        ex::flat_map<int, int, std::less<> > t2(ex::sorted_unique, {{1, 1}, {2, 2}});
+        assert(t == t2 && !(t < t2));
+        t2[0] = 0;
+        assert(t2 < t && t != t2);
+        swap(t, t2);
+        assert(t.size() == 3);
+        assert((*t.rbegin()).first == 2);
+    }
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// <experimental/flat_set>
+
+// Check flat_set and flat_multiset against set and multiset under random
+// single and bulk inserts and erases, sorted and unsorted, and check the
+// branchless bounds against std::lower_bound and std::upper_bound.
+
+#include <experimental/flat_set>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace ex = std::experimental;
+
+template <class Set, class Ref>
+void
+check_equal(const Set& s, const Ref& ref)
+{
+    assert(s.size() == ref.size());
+    assert(std::equal(s.begin(), s.end(), ref.begin()));
+    assert(std::equal(s.rbegin(), s.rend(), ref.rbegin()));
+}
+
+template <class Set, class Ref>
+void
+check_lookups(const Set& s, const Ref& ref, int limit)
+{
+    for (int k = -1; k <= limit; ++k)
+    {
+        assert(s.count(k) == ref.count(k));
+        assert(s.contains(k) == (ref.count(k) != 0));
+        assert(s.lower_bound(k) - s.begin() ==
+               std::distance(ref.begin(), ref.lower_bound(k)));
+        assert(s.upper_bound(k) - s.begin() ==
+               std::distance(ref.begin(), ref.upper_bound(k)));
+        assert((s.find(k) == s.end()) == (ref.find(k) == ref.end()));
+        if (s.find(k) != s.end())
+            assert(*s.find(k) == k);
+    }
+}
+
+template <class Set, class Ref, class Tag>
+void
+random_ops(Tag tag)
+{
+    std::mt19937 gen(42);
+    Set s;
+    Ref ref;
+    for (int step = 0; step < 2000; ++step)
+    {
+        int k = static_cast<int>(gen() % 200);
+        switch (gen() % 6)
+        {
+        case 0:
+            s.insert(k);
+            ref.insert(k);
+            break;
+        case 1:
+            s.insert(s.lower_bound(static_cast<int>(gen() % 200)), k);
+            ref.insert(k);
+            break;
+        case 2:
+            assert(s.erase(k) == ref.erase(k));
+            break;
+        case 3:
+        {
+            std::vector<int> v;
+            for (unsigned n = gen() % 20; n > 0; --n)
+                v.push_back(static_cast<int>(gen() % 200));
+            s.insert(v.begin(), v.end());
+            ref.insert(v.begin(), v.end());
+            break;
+        }
+        case 4:
+        {
+            std::vector<int> v;
+            for (unsigned n = gen() % 20; n > 0; --n)
+                v.push_back(static_cast<int>(gen() % 200));
+            std::sort(v.begin(), v.end());
+            Ref once(v.begin(), v.end());
+            v.assign(once.begin(), once.end());
+            s.insert(tag, v.begin(), v.end());
+            ref.insert(v.begin(), v.end());
+            break;
+        }
+        case 5:
+            if (!s.empty())
+            {
+                typename Set::size_type i = gen() % s.size();
+                typename Ref::iterator r = ref.begin();
+                std::advance(r, i);
+                ref.erase(r);
+                s.erase(s.begin() + i);
+            }
+            break;
+        }
+        check_equal(s, ref);
+    }
+    check_lookups(s, ref, 200);
+}
+
+int main(int, char**)
+{
+    random_ops<ex::flat_set<int>, std::set<int> >(ex::sorted_unique);
+    random_ops<ex::flat_multiset<int>, std::multiset<int> >(ex::sorted_equivalent);
+    random_ops<ex::flat_set<int, std::less<int>, std::deque<int> >, std::set<int> >(
+        ex::sorted_unique);
+
+    // The bounds for every size, including the empty range.
+    for (int n = 0; n < 40; ++n)
+    {
+        std::vector<int> v;
+        for (int i = 0; i < n; ++i)
+            v.push_back(i / 2 * 2);
+        ex::flat_multiset<int> s(ex::sorted_equivalent, v.begin(), v.end());
+        for (int k = -1; k <= n; ++k)
+        {
+            assert(s.lower_bound(k) - s.begin() ==
+                   std::lower_bound(v.begin(), v.end(), k) - v.begin());
+            assert(s.upper_bound(k) - s.begin() ==
+                   std::upper_bound(v.begin(), v.end(), k) - v.begin());
+        }
+    }
+    {
+        // Construction sorts and removes duplicates; the first one wins.
+        std::vector<std::string> v;
+        v.push_back("b");
+        v.push_back("a");
+        v.push_back("c");
+        v.push_back("a");
+        ex::flat_set<std::string> s(v);
+        assert(s.size() == 3);
+        assert(*s.begin() == "a" && *(s.end() - 1) == "c");
+        std::vector<std::string> keys = std::move(s).extract();
+        assert(s.empty() && keys.size() == 3);
+        s.replace(std::move(keys));
+        assert(s.size() == 3);
+
+        ex::flat_set<int, std::greater<int> > g = {1, 5, 3, 5};
+        assert(g.size() == 3 && *g.begin() == 5);
+        ex::flat_set<int, std::less<> > t = {1, 2, 3};
+        assert(t.contains(2L) && t.count(4L) == 0);
+
+        ex::flat_multiset<int> m = {3, 1, 3, 2};
+        ex::erase_if(m, [](int x) { return x == 3; });
+        assert(m.size() == 2);
+        ex::flat_multiset<int> m2 = {1, 2};
+        assert(m == m2 && !(m < m2) && m <= m2);
+        m2.insert(0);
+        assert(m != m2 && m2 < m);
+        swap(m, m2);
+        assert(m.size() == 3);
+    }
+
+  return 0;
+}
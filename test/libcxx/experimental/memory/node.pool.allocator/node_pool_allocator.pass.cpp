@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/node_pool_allocator>
+
+// template <class T, class Alloc = allocator<T>> class node_pool_allocator;
+
+#include <experimental/node_pool_allocator>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <cassert>
+#include <cstddef>
+
+#include "test_macros.h"
+
+namespace ex = std::experimental;
+
+// Counts the upstream allocations that are still live.
+template <class T>
+struct counting_allocator
+{
+    typedef T value_type;
+    int* live;
+
+    explicit counting_allocator(int* l) : live(l) {}
+    template <class U>
+    counting_allocator(const counting_allocator<U>& a) : live(a.live) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++*live;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n)
+    {
+        --*live;
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+template <class T, class U>
+bool operator==(const counting_allocator<T>& x, const counting_allocator<U>& y)
+{
+    return x.live == y.live;
+}
+
+template <class T, class U>
+bool operator!=(const counting_allocator<T>& x, const counting_allocator<U>& y)
+{
+    return !(x == y);
+}
+
+int main(int, char**)
+{
+    {
+        // Copies and rebound copies share pools; freed nodes are reused.
+        typedef ex::node_pool_allocator<int> A;
+        A a;
+        A b(a);
+        A c;
+        ex::node_pool_allocator<double> d(a);
+        assert(a == b);
+        assert(a != c);
+        assert(d == a);
+        assert(A(d) == a);
+
+        int* p = a.allocate(1);
+        int* q = a.allocate(1);
+        assert(p != q);
+        b.deallocate(p, 1);
+        assert(A(d).allocate(1) == p);
+        int* r = a.allocate(5);
+        a.deallocate(r, 5);
+        a.deallocate(q, 1);
+        a.deallocate(p, 1);
+    }
+    {
+        // Slabs go back upstream once the last allocator sharing them is
+        // destroyed.
+        int live = 0;
+        {
+            typedef counting_allocator<int> U;
+            typedef ex::node_pool_allocator<int, U> A;
+            std::set<int, std::less<int>, A> s((A(U(&live))));
+            for (int i = 0; i < 1000; ++i)
+                s.insert(i);
+            int slabs = live;
+            assert(slabs > 0 && slabs < 20);
+            for (int round = 0; round < 10; ++round)
+            {
+                for (int i = 0; i < 1000; i += 2)
+                    s.erase(i);
+                for (int i = 0; i < 1000; i += 2)
+                    s.insert(i);
+            }
+            assert(live == slabs);
+            assert(s.size() == 1000);
+            int expected = 0;
+            for (std::set<int, std::less<int>, A>::iterator i = s.begin(); i != s.end(); ++i)
+                assert(*i == expected++);
+        }
+        assert(live == 0);
+    }
+    {
+        typedef ex::node_pool_allocator<std::pair<const int, int> > A;
+        std::map<int, int, std::less<int>, A> m;
+        std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, A> u;
+        for (int i = 0; i < 500; ++i)
+        {
+            m[i] = i;
+            u[i] = i;
+        }
+        std::map<int, int, std::less<int>, A> m2(m);
+        std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, A> u2(u);
+        assert(m2.get_allocator() == m.get_allocator());
+        m.clear();
+        u.clear();
+        assert(m2.size() == 500 && u2.size() == 500);
+        for (int i = 0; i < 500; ++i)
+            assert(m2[i] == i && u2[i] == i);
+        m.swap(m2);
+        u = std::move(u2);
+        assert(m.size() == 500 && u.size() == 500);
+    }
+    {
+        typedef ex::node_pool_allocator<int> A;
+        std::list<int, A> l;
+        for (int i = 0; i < 100; ++i)
+            l.push_back(i);
+        std::list<int, A> l2(l.get_allocator());
+        l2.splice(l2.end(), l);
+        assert(l.empty() && l2.size() == 100);
+        l2.remove_if([](int x) { return x % 3 == 0; });
+        assert(l2.size() == 66);
+    }
+
+  return 0;
+}
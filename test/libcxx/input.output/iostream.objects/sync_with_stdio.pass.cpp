@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// XFAIL: libcpp-has-no-stdin, libcpp-has-no-stdout
+
+// <iostream>
+
+// After ios_base::sync_with_stdio(false), cin and cout read and write
+// through buffers of their own.  Switching back flushes them.
+
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <string>
+
+#include "platform_support.h" // get_temp_file_name
+
+std::string read_file(const std::string& name)
+{
+    std::string r;
+    FILE* f = std::fopen(name.c_str(), "r");
+    assert(f != NULL);
+    for (int c; (c = std::getc(f)) != EOF;)
+        r += static_cast<char>(c);
+    std::fclose(f);
+    return r;
+}
+
+int main()
+{
+    std::string in_name = get_temp_file_name();
+    std::string out_name = get_temp_file_name();
+
+    std::string long_line(40000, 'x');
+    FILE* f = std::fopen(in_name.c_str(), "w");
+    assert(f != NULL);
+    std::fputs("12 abc\nline two\n", f);
+    std::fputs(long_line.c_str(), f);
+    std::fputs("\n-7", f);
+    std::fclose(f);
+    assert(std::freopen(in_name.c_str(), "r", stdin) != NULL);
+    assert(std::freopen(out_name.c_str(), "w", stdout) != NULL);
+
+    assert(std::ios_base::sync_with_stdio(false));
+
+    int i = 0;
+    std::string s;
+    std::cin >> i >> s;
+    assert(i == 12 && s == "abc");
+    assert(std::cin.get() == '\n');
+    assert(std::cin.unget());
+    assert(std::cin.get() == '\n');
+    std::getline(std::cin, s);
+    assert(s == "line two");
+    std::getline(std::cin, s);
+    assert(s == long_line);
+    std::cin >> i;
+    assert(i == -7);
+    assert(std::cin.get() == EOF);
+    std::cin.clear();
+
+    std::cout << "first " << 1 << '\n';
+    for (int n = 0; n < 1000; ++n)
+        std::cout.put('a');
+    std::cout << long_line;
+    std::cout.write("end\n", 4);
+    std::cout.flush();
+    assert(read_file(out_name) == "first 1\n" + std::string(1000, 'a') + long_line + "end\n");
+
+    std::cout << "pending";
+    assert(!std::ios_base::sync_with_stdio(true));
+    std::printf("|printf");
+    std::cout << "|cout";
+    std::fflush(stdout);
+    assert(read_file(out_name) == "first 1\n" + std::string(1000, 'a') + long_line +
+                                  "end\npending|printf|cout");
+
+    std::remove(in_name.c_str());
+    std::remove(out_name.c_str());
+}
@@ -101,6 +101,8 @@ TEST_MACROS();
 TEST_MACROS();
 #include <exception>
 TEST_MACROS();
+#include <execution>
+TEST_MACROS();
 #include <float.h>
 TEST_MACROS();
 #include <forward_list>
@@ -242,6 +244,14 @@ TEST_MACROS();
 TEST_MACROS();
 #include <experimental/filesystem>
 TEST_MACROS();
+#include <experimental/flat_hash_map>
+TEST_MACROS();
+#include <experimental/flat_hash_set>
+TEST_MACROS();
+#include <experimental/flat_map>
+TEST_MACROS();
+#include <experimental/flat_set>
+TEST_MACROS();
 #include <experimental/forward_list>
 TEST_MACROS();
 #include <experimental/functional>
@@ -254,6 +264,8 @@ TEST_MACROS();
 TEST_MACROS();
 #include <experimental/memory_resource>
 TEST_MACROS();
+#include <experimental/node_pool_allocator>
+TEST_MACROS();
 #include <experimental/propagate_const>
 TEST_MACROS();
 #include <experimental/regex>
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+// UNSUPPORTED: libcpp-no-exceptions
+
+// <regex>
+
+// With _LIBCPP_ABI_REGEX_NFA, patterns without back references or lookahead
+// are matched by a Thompson NFA in time linear in the input, and report the
+// same submatches as the backtracking matcher.
+
+#include <regex>
+#include <cassert>
+#include <string>
+
+#include "test_macros.h"
+
+static void check(const char* pattern, const char* input,
+                  std::regex::flag_type f, const char* const* expected,
+                  int n)
+{
+    std::cmatch m;
+    assert(std::regex_search(input, m, std::regex(pattern, f)));
+    assert(m.size() == static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i)
+    {
+        if (expected[i] == nullptr)
+            assert(!m[i].matched);
+        else
+            assert(m[i].matched && m[i].str() == expected[i]);
+    }
+}
+
+void test_submatches()
+{
+    {
+        const char* e[] = {"ab", "a", nullptr};
+        check("(a|ab)(c|bcd)?b?", "xabd", std::regex::ECMAScript, e, 3);
+    }
+    {
+        const char* e[] = {"abcd", "a", "bcd"};
+        check("(a|ab)(c|bcd)", "abcd", std::regex::ECMAScript, e, 3);
+    }
+    {
+        // Captures inside a loop are reset on every iteration.
+        const char* e[] = {"ab", nullptr, "b"};
+        check("(?:(a)|(b))+", "ab", std::regex::ECMAScript, e, 3);
+        const char* f[] = {"aba", "a", nullptr};
+        check("(?:(a)|(b))+", "aba", std::regex::ECMAScript, f, 3);
+    }
+    {
+        // An empty iteration ends the loop.
+        const char* e[] = {"ab", ""};
+        check("([ab]|)+", "ab ", std::regex::ECMAScript, e, 2);
+    }
+    {
+        const char* e[] = {"aaa", "a"};
+        check("(a){2,3}", "aaaa", std::regex::ECMAScript, e, 2);
+        const char* f[] = {"aa", "a"};
+        check("(a){2,3}?", "aaaa", std::regex::ECMAScript, f, 2);
+    }
+    {
+        const char* e[] = {"foo bar"};
+        check("\\bfoo\\s+bar\\b", "a foo bar", std::regex::ECMAScript, e, 1);
+    }
+    {
+        // POSIX grammars pick the longest match.
+        const char* e[] = {"abcd"};
+        check("a|ab|abcd", "abcd", std::regex::extended, e, 1);
+        check("a|ab|abcd", "abcd", std::regex::egrep, e, 1);
+        const char* f[] = {"a"};
+        check("a|ab|abcd", "abcd", std::regex::ECMAScript, f, 1);
+    }
+    {
+        std::cmatch m;
+        assert(!std::regex_match("abcx", m, std::regex("[a-c]+")));
+        assert(std::regex_match("abc", m, std::regex("[a-c]+")));
+        assert(!std::regex_search("abc", m, std::regex("^b")));
+        assert(!std::regex_search("", m, std::regex("a*"),
+                                  std::regex_constants::match_not_null));
+    }
+}
+
+#ifdef _LIBCPP_ABI_REGEX_NFA
+void test_long_input()
+{
+    std::string s(100000, 'a');
+    s += 'b';
+    const char* patterns[] = {"(a|aa)*b", "(a*)*b", "(?:a?){20}a{20}b",
+                              "(x+x+)+y"};
+    for (const char* p : patterns)
+    {
+        std::smatch m;
+        assert(std::regex_search(s, m, std::regex(p)) == (p[1] != 'x'));
+    }
+    assert(std::regex_match(s, std::regex("(a|b)*")));
+    assert(std::regex_match(s, std::regex("[ab]*", std::regex::extended)));
+}
+#endif
+
+int main(int, char**)
+{
+    test_submatches();
+#ifdef _LIBCPP_ABI_REGEX_NFA
+    test_long_input();
+#endif
+    return 0;
+}
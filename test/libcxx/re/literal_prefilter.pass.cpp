@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <regex>
+
+// regex_search skips to the places where the literal prefix of the pattern
+// occurs, and fails early when a literal that every match contains is
+// missing.  Neither changes the result.
+
+#include <regex>
+#include <cassert>
+#include <iterator>
+#include <string>
+
+#include "test_macros.h"
+
+template <class CharT>
+void test_search(const CharT* pattern, const CharT* input, std::ptrdiff_t pos,
+                 std::ptrdiff_t len,
+                 std::regex_constants::match_flag_type flags =
+                     std::regex_constants::match_default,
+                 std::regex_constants::syntax_option_type f =
+                     std::regex_constants::ECMAScript)
+{
+    std::match_results<const CharT*> m;
+    bool found = std::regex_search(input, m, std::basic_regex<CharT>(pattern, f),
+                                   flags);
+    assert(found == (pos >= 0));
+    if (found)
+    {
+        assert(m.position(0) == pos);
+        assert(m.length(0) == len);
+    }
+}
+
+int main(int, char**)
+{
+    // Literal prefixes.
+    test_search("ERROR: (\\d+)", "INFO: 1 ERROR: x ERROR: 42", 17, 9);
+    test_search("ERROR: (\\d+)", "INFO: 1 ERROR: x ERROR:", -1, 0);
+    test_search("ab+c", "aabbcabc", 1, 4);
+    test_search("ab\\b", "abc ab", 4, 2);
+    test_search("ab\\b", "abc ab", -1, 0,
+                std::regex_constants::match_continuous);
+    test_search("^ab", "xab", -1, 0);
+    test_search("ab", "xab", -1, 0, std::regex_constants::match_continuous);
+    test_search("ab", "", -1, 0);
+    test_search("a|ab", "xxab", 2, 1);
+    test_search("ab|cd", "xxcd", 2, 2, std::regex_constants::match_default,
+                std::regex_constants::extended);
+    test_search("abc", "xABC", 1, 3, std::regex_constants::match_default,
+                std::regex_constants::icase);
+    test_search(L"ab+c", L"aabbcabc", 1, 4);
+
+    // Back references still use the backtracking matcher.
+    test_search("a(b)\\1c", "abc abbc", 4, 4);
+    test_search("a(b)\\1c", "abc abc", -1, 0);
+
+    // Required literals.
+    test_search("(\\w+) code=(\\d+)", "x code=1", 0, 8);
+    test_search("(\\w+) code=(\\d+)", "x code=y", -1, 0);
+    test_search("(\\w+) code=(\\d+)", "x codex=1", -1, 0);
+    test_search("[a-c]hello", "ahellx bhello", 7, 6);
+
+    {
+        // Consecutive matches, where only the first starts at the beginning.
+        std::string s = "key=1 key=22 kex=3 key=333";
+        std::regex re("key=(\\d+)");
+        std::sregex_iterator i(s.begin(), s.end(), re), e;
+        assert(std::distance(i, e) == 3);
+        assert((*i)[1] == "1");
+        assert((*++i)[1] == "22");
+        assert((*++i)[1] == "333");
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <regex>
+
+// With _LIBCPP_ABI_REGEX_MATCH_SCRATCH, a match_results keeps the working
+// storage of the searches made with it, so that searching again with it, or
+// incrementing a regex_iterator, reuses that storage.  The result of a search
+// must not depend on what the storage was used for before.
+
+#include <regex>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class M>
+bool same(const M& a, const M& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+        if (a[i].matched != b[i].matched ||
+            (a[i].matched && (a.position(i) != b.position(i) ||
+                              a.length(i) != b.length(i))))
+            return false;
+    return true;
+}
+
+std::string digit(int i)
+{
+    return std::string(1, static_cast<char>('0' + i));
+}
+
+int main(int, char**)
+{
+    std::vector<std::string> lines;
+    for (int i = 0; i < 100; ++i)
+        lines.push_back("2020-01-01 INFO served path=/index" + digit(i / 10) +
+                        digit(i % 10) + ".html in " + digit(i % 7) + "ms");
+    lines.push_back("");
+    lines.push_back("path=");
+
+    // Programs of different sizes share the storage of one match_results.
+    std::regex res[] = {std::regex("(\\w+)=(\\S+) in (\\d+)ms"),
+                        std::regex("(a|b)*"),
+                        std::regex("(?:(\\w)|(/)){2,20}\\.html"),
+                        std::regex("[a-z]+", std::regex::extended),
+                        std::regex("x"),
+                        std::regex("(d)\\1")};
+    {
+        std::smatch m;
+        std::cmatch cm;
+        for (int pass = 0; pass < 3; ++pass)
+            for (const std::string& line : lines)
+                for (const std::regex& re : res)
+                {
+                    std::smatch fresh;
+                    std::cmatch cfresh;
+                    bool found = std::regex_search(line, fresh, re);
+                    assert(std::regex_search(line, m, re) == found);
+                    assert(same(m, fresh));
+                    assert(std::regex_search(line.begin(), line.end(), m, re) == found);
+                    assert(same(m, fresh));
+                    assert(std::regex_search(line.c_str(), cm, re) == found);
+                    found = std::regex_match(line.c_str(), cfresh, re);
+                    assert(std::regex_match(line.c_str(), cm, re) == found);
+                    assert(same(cm, cfresh));
+                }
+    }
+    {
+        std::string text;
+        for (const std::string& line : lines)
+            text += line + "\n";
+        std::sregex_iterator i(text.begin(), text.end(), res[0]), e;
+        int n = 0;
+        for (; i != e; ++i)
+        {
+            assert((*i)[1] == "path");
+            assert((*i)[3] == digit(n % 7));
+            ++n;
+        }
+        assert(n == 100);
+    }
+    {
+        // Copies of a match_results do not share its storage.
+        std::smatch m1;
+        assert(std::regex_search(lines[0], m1, res[0]));
+        std::smatch m2 = m1;
+        assert(std::regex_search(lines[1], m2, res[0]));
+        assert(m1[3] == "0" && m2[3] == "1");
+        m1 = m2;
+        assert(m1[3] == "1");
+        assert(std::regex_search(lines[2], m1, res[0]));
+        m1.swap(m2);
+        assert(m1[3] == "1" && m2[3] == "2");
+    }
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// find and rfind switch to the Two-Way search on repetitive text, and the
+// find_*_of members of strings of bytes use a bitmap of the set; both give
+// the same results as a naive search.
+
+#include <string>
+#include <cassert>
+#include <cstddef>
+
+#include "test_macros.h"
+
+template <class S>
+typename S::size_type naive_find(const S& s, const S& p, typename S::size_type pos)
+{
+    if (pos > s.size())
+        return S::npos;
+    for (typename S::size_type i = pos; i + p.size() <= s.size(); ++i)
+        if (s.compare(i, p.size(), p) == 0)
+            return i;
+    return S::npos;
+}
+
+template <class S>
+typename S::size_type naive_rfind(const S& s, const S& p, typename S::size_type pos)
+{
+    if (p.size() > s.size())
+        return S::npos;
+    typename S::size_type i = pos < s.size() - p.size() ? pos : s.size() - p.size();
+    for (;; --i)
+    {
+        if (s.compare(i, p.size(), p) == 0)
+            return i;
+        if (i == 0)
+            return S::npos;
+    }
+}
+
+template <class S>
+S str(const char* s)
+{
+    return S(s, s + std::char_traits<char>::length(s));
+}
+
+// Deterministic strings over a small alphabet, so that partial matches are
+// frequent.
+template <class S>
+S make(unsigned& seed, std::size_t n, int alphabet)
+{
+    S s;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        s.push_back(static_cast<typename S::value_type>('a' + (seed >> 16) % alphabet));
+    }
+    return s;
+}
+
+template <class S>
+void test_search()
+{
+    typedef typename S::size_type size_type;
+    unsigned seed = 1;
+    for (int alphabet = 1; alphabet <= 3; ++alphabet)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            S s = make<S>(seed, 2000, alphabet);
+            S p = make<S>(seed, 1 + i % 40, alphabet);
+            const size_type positions[] = {0, 1, 700, 1999, 2000, S::npos};
+            for (int j = 0; j < 6; ++j)
+            {
+                assert(s.find(p, positions[j]) == naive_find(s, p, positions[j]));
+                assert(s.rfind(p, positions[j]) == naive_rfind(s, p, positions[j]));
+            }
+        }
+    }
+
+    // Runs of 'a' with a pattern that almost matches at every position.
+    S text(10000, 'a');
+    S pattern = S(100, 'a') + S(1, 'b') + S(100, 'a');
+    assert(text.find(pattern) == S::npos);
+    assert(text.rfind(pattern) == S::npos);
+    text[5000] = 'b';
+    assert(text.find(pattern) == 4900);
+    assert(text.rfind(pattern) == 4900);
+    assert(text.find(S(1000, 'a') + S(1, 'b')) == 4000);
+    assert(text.rfind(S(1, 'b') + S(1000, 'a')) == 5000);
+    assert(text.find(str<S>("ab")) == 4999);
+    assert(text.rfind(str<S>("ba")) == 5000);
+}
+
+template <class S>
+void test_sets()
+{
+    typedef typename S::size_type size_type;
+    unsigned seed = 7;
+    S s = make<S>(seed, 500, 26);
+    s.push_back(static_cast<typename S::value_type>(-1));
+    s.push_back(static_cast<typename S::value_type>(0));
+    const S sets[] = {S(), str<S>("x"), str<S>("aeiou"), make<S>(seed, 20, 26),
+                      S(1, static_cast<typename S::value_type>(-1)),
+                      S(1, static_cast<typename S::value_type>(0)) + str<S>("q")};
+    for (int i = 0; i < 6; ++i)
+    {
+        const S& set = sets[i];
+        for (size_type pos = 0; pos <= s.size() + 1; pos += 13)
+        {
+            size_type first = S::npos, first_not = S::npos;
+            for (size_type k = pos; k < s.size(); ++k)
+            {
+                bool in = set.find(s[k]) != S::npos;
+                if (in && first == S::npos)
+                    first = k;
+                if (!in && first_not == S::npos)
+                    first_not = k;
+            }
+            size_type last = S::npos, last_not = S::npos;
+            for (size_type k = 0; k <= pos && k < s.size(); ++k)
+            {
+                if (set.find(s[k]) != S::npos)
+                    last = k;
+                else
+                    last_not = k;
+            }
+            assert(s.find_first_of(set, pos) == first);
+            assert(s.find_first_not_of(set, pos) == first_not);
+            assert(s.find_last_of(set, pos) == last);
+            assert(s.find_last_not_of(set, pos) == last_not);
+        }
+    }
+}
+
+int main()
+{
+    test_search<std::string>();
+    test_search<std::wstring>();
+    test_sets<std::string>();
+    test_sets<std::wstring>();
+}
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Not a portable test
+
+// Test the string hashes used with _LIBCPP_ABI_FAST_STRING_HASH against the
+// xxHash32 and wyhash reference values, and that wide characters hash like
+// their little endian bytes.
+
+#include <utility>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include "test_macros.h"
+
+typedef std::__xxhash32_or_wyhash<uint32_t> Hash32;
+typedef std::__xxhash32_or_wyhash<uint64_t> Hash64;
+
+struct Vector {
+  const char* key;
+  uint32_t hash32;
+  uint64_t hash64;
+};
+
+const Vector vectors[] = {
+  {"", 0x02cc5d05U, 0x0409638ee2bde459ULL},
+  {"a", 0x550d7456U, 0x28d2053309d28531ULL},
+  {"abc", 0x32d153ffU, 0x02a4f1d7cb516c72ULL},
+  {"message digest", 0x7c948494U, 0x41d032e1df79b67eULL},
+  {"abcdefghijklmnopqrstuvwxyz", 0x63a14d5fU, 0x774fa8c21ed6acd2ULL},
+  {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+   0x9c285e64U, 0x0369bcbe3f0f0c0dULL},
+  {"1234567890123456789012345678901234567890"
+   "1234567890123456789012345678901234567890", 0x9c05f475U, 0x48662e17cabfab37ULL},
+};
+
+int main() {
+  for (const Vector& v : vectors) {
+    const uint32_t len = static_cast<uint32_t>(std::strlen(v.key));
+    assert(Hash32()(v.key, len) == v.hash32);
+#ifndef __CHEERP__
+    assert(Hash64()(v.key, len) == v.hash64);
+#endif
+  }
+
+  const char16_t wide16[] = u"0123456789abcdefghij";
+  const char32_t wide32[] = U"0123456789abcdefghij";
+  unsigned char bytes16[sizeof(wide16)];
+  unsigned char bytes32[sizeof(wide32)];
+  for (std::size_t i = 0; i < 21; ++i) {
+    for (std::size_t b = 0; b < 2; ++b)
+      bytes16[2 * i + b] = static_cast<unsigned char>(wide16[i] >> (8 * b));
+    for (std::size_t b = 0; b < 4; ++b)
+      bytes32[4 * i + b] = static_cast<unsigned char>(wide32[i] >> (8 * b));
+  }
+  for (uint32_t n = 0; n <= 20; ++n) {
+    assert(Hash32()(wide16, 2 * n) == Hash32()(bytes16, 2 * n));
+    assert(Hash32()(wide32, 4 * n) == Hash32()(bytes32, 4 * n));
+  }
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// test the extensions size_t _Find_first() const and
+// size_t _Find_next(size_t prev) const;
+
+#include <bitset>
+#include <cstdlib>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <std::size_t N>
+std::bitset<N>
+make_bitset(int density)
+{
+    std::bitset<N> v;
+    for (std::size_t i = 0; i < N; ++i)
+        v[i] = std::rand() % density == 0;
+    return v;
+}
+
+template <std::size_t N>
+void test_find(int density)
+{
+    const std::bitset<N> v = make_bitset<N>(density);
+    std::size_t expected = 0;
+    while (expected < N && !v[expected])
+        ++expected;
+    assert(v._Find_first() == expected);
+    for (std::size_t i = 0; i < N + 2; ++i)
+    {
+        expected = i + 1;
+        while (expected < N && !v[expected])
+            ++expected;
+        if (expected > N)
+            expected = N;
+        assert(v._Find_next(i) == expected);
+    }
+    assert(v._Find_next(std::size_t(-1)) == N);
+
+    std::size_t c = 0;
+    for (std::size_t i = v._Find_first(); i < N; i = v._Find_next(i))
+    {
+        assert(v[i]);
+        ++c;
+    }
+    assert(c == v.count());
+}
+
+template <std::size_t N>
+void test()
+{
+    test_find<N>(1);
+    test_find<N>(2);
+    test_find<N>(50);
+    test_find<N>(N + 1);
+}
+
+int main()
+{
+    test<0>();
+    test<1>();
+    test<31>();
+    test<32>();
+    test<33>();
+    test<63>();
+    test<64>();
+    test<65>();
+    test<1000>();
+}
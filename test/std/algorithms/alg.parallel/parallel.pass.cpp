@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <execution>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// The parallel overloads of the algorithms have to give the same results as
+// the serial ones, for every policy and whether or not the input is large
+// enough to be split.
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include "test_macros.h"
+#include "test_iterators.h"
+
+struct Key
+{
+    int value;
+    int order;
+};
+
+bool operator<(const Key& x, const Key& y) { return x.value < y.value; }
+
+std::vector<int> make_input(int n)
+{
+    std::vector<int> v(n);
+    unsigned s = 12345;
+    for (int& x : v)
+    {
+        s = s * 1103515245 + 12345;
+        x = static_cast<int>((s >> 16) % 1000);
+    }
+    return v;
+}
+
+template <class Policy>
+void test(const Policy& policy, int n)
+{
+    const std::vector<int> in = make_input(n);
+    std::vector<int> out(n);
+    std::vector<int> expected(n);
+
+    // for_each, for_each_n
+    {
+        std::vector<int> v = in;
+        std::for_each(policy, v.begin(), v.end(), [](int& x) { x *= 2; });
+        for (int i = 0; i < n; ++i)
+            assert(v[i] == 2 * in[i]);
+        assert(std::for_each_n(policy, v.begin(), n / 2, [](int& x) { x = 0; }) == v.begin() + n / 2);
+        assert(std::count(v.begin(), v.begin() + n / 2, 0) == n / 2);
+    }
+
+    // transform
+    {
+        assert(std::transform(policy, in.begin(), in.end(), out.begin(),
+                              [](int x) { return x + 1; }) == out.end());
+        std::transform(in.begin(), in.end(), expected.begin(), [](int x) { return x + 1; });
+        assert(out == expected);
+        std::transform(policy, in.begin(), in.end(), out.begin(), out.begin(),
+                       [](int x, int y) { return x * y; });
+        for (int i = 0; i < n; ++i)
+            assert(out[i] == in[i] * (in[i] + 1));
+    }
+
+    // reduce, transform_reduce
+    {
+        long long sum = std::accumulate(in.begin(), in.end(), 0LL);
+        assert(std::reduce(policy, in.begin(), in.end()) == static_cast<int>(sum));
+        assert(std::reduce(policy, in.begin(), in.end(), 0LL) == sum);
+        assert(std::reduce(policy, in.begin(), in.end(), 7LL, std::plus<>()) == sum + 7);
+        assert(std::transform_reduce(policy, in.begin(), in.end(), 0LL, std::plus<>(),
+                                     [](int x) { return 2LL * x; }) == 2 * sum);
+        long long dot = std::inner_product(in.begin(), in.end(), in.begin(), 0LL);
+        assert(std::transform_reduce(policy, in.begin(), in.end(), in.begin(), 0LL) == dot);
+        assert(std::transform_reduce(policy, in.begin(), in.end(), in.begin(), 0LL,
+                                     std::plus<>(), std::multiplies<>()) == dot);
+    }
+
+    // inclusive_scan, exclusive_scan
+    {
+        std::partial_sum(in.begin(), in.end(), expected.begin());
+        assert(std::inclusive_scan(policy, in.begin(), in.end(), out.begin()) == out.end());
+        assert(out == expected);
+        std::inclusive_scan(policy, in.begin(), in.end(), out.begin(), std::plus<>());
+        assert(out == expected);
+        std::inclusive_scan(policy, in.begin(), in.end(), out.begin(), std::plus<>(), 5);
+        for (int i = 0; i < n; ++i)
+            assert(out[i] == expected[i] + 5);
+        assert(std::exclusive_scan(policy, in.begin(), in.end(), out.begin(), 5) == out.end());
+        for (int i = 0; i < n; ++i)
+            assert(out[i] == 5 + (i == 0 ? 0 : expected[i - 1]));
+
+        // In place.
+        std::vector<int> v = in;
+        std::exclusive_scan(policy, v.begin(), v.end(), v.begin(), 0, std::plus<>());
+        for (int i = 0; i < n; ++i)
+            assert(v[i] == (i == 0 ? 0 : expected[i - 1]));
+    }
+
+    // count, count_if, copy_if
+    {
+        auto odd = [](int x) { return x % 2 != 0; };
+        assert(std::count_if(policy, in.begin(), in.end(), odd) ==
+               std::count_if(in.begin(), in.end(), odd));
+        assert(std::count(policy, in.begin(), in.end(), 42) ==
+               std::count(in.begin(), in.end(), 42));
+        auto e = std::copy_if(in.begin(), in.end(), expected.begin(), odd);
+        auto o = std::copy_if(policy, in.begin(), in.end(), out.begin(), odd);
+        assert(o - out.begin() == e - expected.begin());
+        assert(std::equal(out.begin(), o, expected.begin()));
+    }
+
+    // sort, stable_sort
+    {
+        std::vector<int> v = in;
+        std::sort(policy, v.begin(), v.end());
+        expected = in;
+        std::sort(expected.begin(), expected.end());
+        assert(v == expected);
+        v = in;
+        std::sort(policy, v.begin(), v.end(), std::greater<int>());
+        assert(std::equal(v.begin(), v.end(), expected.rbegin()));
+
+        std::vector<Key> keys(n);
+        for (int i = 0; i < n; ++i)
+            keys[i] = Key{in[i] % 10, i};
+        std::stable_sort(policy, keys.begin(), keys.end());
+        for (int i = 1; i < n; ++i)
+            assert(keys[i - 1].value < keys[i].value ||
+                   (keys[i - 1].value == keys[i].value && keys[i - 1].order < keys[i].order));
+    }
+
+    // Iterators that can't be split run the serial algorithms.
+    {
+        typedef forward_iterator<const int*> Iter;
+        const int* p = in.data();
+        assert(std::reduce(policy, Iter(p), Iter(p + n), 0LL) ==
+               std::accumulate(in.begin(), in.end(), 0LL));
+        assert(std::count(policy, Iter(p), Iter(p + n), 42) ==
+               std::count(in.begin(), in.end(), 42));
+    }
+}
+
+template <class Policy>
+void test(const Policy& policy)
+{
+    const int sizes[] = {1, 2, 100, 5000, 100000};
+    for (int n : sizes)
+        test(policy, n);
+}
+
+int main(int, char**)
+{
+    test(std::execution::seq);
+    test(std::execution::par);
+    test(std::execution::par_unseq);
+#if TEST_STD_VER > 17
+    test(std::execution::unseq);
+#endif
+
+  return 0;
+}
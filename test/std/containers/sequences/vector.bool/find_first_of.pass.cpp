@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+// vector<bool>
+
+// std::find_first_of with vector<bool>::iterator
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+int main()
+{
+    const bool t[] = {true};
+    const bool f[] = {false};
+    const bool tf[] = {true, false};
+    const int other[] = {2, 3};
+    const int one[] = {2, 1};
+    for (std::size_t n = 0; n < 200; n += 7)
+    {
+        for (std::size_t first = 0; first < n; first += 5)
+        {
+            std::vector<bool> b(n, false);
+            std::size_t pos = (first + n) / 2;
+            b[pos] = true;
+            std::vector<bool>::iterator i = b.begin() + first;
+            assert(std::find_first_of(i, b.end(), t, t + 1) - b.begin() == static_cast<long>(pos));
+            assert(std::find_first_of(i, b.end(), one, one + 2) - b.begin() == static_cast<long>(pos));
+            assert(std::find_first_of(i, b.end(), f, f + 1) - b.begin() ==
+                   static_cast<long>(pos == first ? first + 1 : first));
+            assert(std::find_first_of(i, b.end(), tf, tf + 2) == i);
+            assert(std::find_first_of(i, b.end(), other, other + 2) == b.end());
+            assert(std::find_first_of(i, b.end(), t, t) == b.end());
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+// vector<bool>
+
+// std::transform with vector<bool>::iterator and the logical and bitwise
+// function objects, at every combination of bit offsets.
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+#include "test_macros.h"
+
+std::vector<bool> pattern(std::size_t n, unsigned seed)
+{
+    std::vector<bool> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        v[i] = (seed >> 16) & 1;
+    }
+    return v;
+}
+
+struct Implies
+{
+    bool operator()(bool x, bool y) const {return !x || y;}
+};
+
+const std::size_t offsets[] = {0, 1, 7, 31, 32, 33, 63, 64, 65};
+const std::size_t lengths[] = {0, 1, 2, 30, 32, 63, 64, 65, 128, 200, 1000};
+
+template <class Op>
+void test_binary(Op op)
+{
+    const std::vector<bool> a = pattern(1200, 1);
+    const std::vector<bool> b = pattern(1200, 2);
+    for (std::size_t i = 0; i < 9; ++i)
+    for (std::size_t j = 0; j < 9; ++j)
+    for (std::size_t k = 0; k < 9; ++k)
+    for (std::size_t l = 0; l < 11; ++l)
+    {
+        std::size_t n = lengths[l];
+        std::vector<bool> r = pattern(1200, 3);
+        std::vector<bool> expected = r;
+        for (std::size_t x = 0; x < n; ++x)
+            expected[offsets[k] + x] = op(a[offsets[i] + x], b[offsets[j] + x]);
+        std::vector<bool>::iterator e =
+            std::transform(a.begin() + offsets[i], a.begin() + offsets[i] + n,
+                           b.begin() + offsets[j], r.begin() + offsets[k], op);
+        assert(e == r.begin() + offsets[k] + n);
+        assert(r == expected);
+    }
+    // in place
+    std::vector<bool> r = a;
+    std::transform(r.begin() + 3, r.end(), b.begin() + 3, r.begin() + 3, op);
+    for (std::size_t x = 3; x < r.size(); ++x)
+        assert(r[x] == op(a[x], b[x]));
+}
+
+template <class Op>
+void test_unary(Op op)
+{
+    const std::vector<bool> a = pattern(1200, 4);
+    for (std::size_t i = 0; i < 9; ++i)
+    for (std::size_t k = 0; k < 9; ++k)
+    for (std::size_t l = 0; l < 11; ++l)
+    {
+        std::size_t n = lengths[l];
+        std::vector<bool> r = pattern(1200, 5);
+        std::vector<bool> expected = r;
+        for (std::size_t x = 0; x < n; ++x)
+            expected[offsets[k] + x] = op(a[offsets[i] + x]);
+        std::vector<bool>::iterator e =
+            std::transform(a.cbegin() + offsets[i], a.cbegin() + offsets[i] + n,
+                           r.begin() + offsets[k], op);
+        assert(e == r.begin() + offsets[k] + n);
+        assert(r == expected);
+    }
+}
+
+int main()
+{
+    test_binary(std::logical_and<bool>());
+    test_binary(std::logical_or<bool>());
+    test_binary(std::equal_to<bool>());
+    test_binary(std::not_equal_to<bool>());
+    test_binary(std::bit_and<bool>());
+    test_binary(std::bit_or<bool>());
+    test_binary(std::bit_xor<bool>());
+    test_binary(Implies());
+    test_unary(std::logical_not<bool>());
+#if TEST_STD_VER > 11
+    test_binary(std::logical_and<>());
+    test_binary(std::bit_xor<>());
+    test_binary(std::equal_to<>());
+    test_unary(std::logical_not<>());
+#endif
+}
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: c++experimental
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/memory_resource>
+
+// class monotonic_buffer_resource
+
+#include <experimental/memory_resource>
+#include <experimental/vector>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include "test_memory_resource.hpp"
+
+namespace ex = std::experimental::pmr;
+
+void test_ctors()
+{
+    {
+        ex::monotonic_buffer_resource m;
+        assert(m.upstream_resource() == ex::get_default_resource());
+    }
+    {
+        NullResource upstream;
+        ex::monotonic_buffer_resource m(&upstream);
+        assert(m.upstream_resource() == &upstream);
+        assert(m.is_equal(m));
+        ex::monotonic_buffer_resource other(&upstream);
+        assert(!m.is_equal(other));
+    }
+    static_assert(!std::is_copy_constructible<ex::monotonic_buffer_resource>::value, "");
+    static_assert(!std::is_copy_assignable<ex::monotonic_buffer_resource>::value, "");
+}
+
+void test_initial_buffer()
+{
+    // Requests that fit in the initial buffer don't touch upstream.
+    alignas(16) char buffer[256];
+    NewDeleteResource upstream;
+    AllocController& C = upstream.getController();
+    {
+        ex::monotonic_buffer_resource m(buffer, sizeof(buffer), &upstream);
+        for (int i = 0; i != 8; ++i)
+        {
+            char* p = static_cast<char*>(m.allocate(16, 16));
+            assert(p >= buffer && p + 16 <= buffer + sizeof(buffer));
+            m.deallocate(p, 16, 16);
+        }
+        assert(C.alloc_count == 0);
+
+        // Past the end of the buffer the next chunk comes from upstream.
+        for (int i = 0; i != 16; ++i)
+            m.allocate(16, 16);
+        assert(C.alloc_count == 1);
+        assert(C.last_alloc_size > sizeof(buffer));
+
+        // release() hands the chunks back and reuses the buffer.
+        m.release();
+        assert(C.alive == 0);
+        char* p = static_cast<char*>(m.allocate(16, 16));
+        assert(p >= buffer && p + 16 <= buffer + sizeof(buffer));
+    }
+    assert(C.alive == 0);
+}
+
+void test_growth()
+{
+    NewDeleteResource upstream;
+    AllocController& C = upstream.getController();
+    {
+        ex::monotonic_buffer_resource m(64, &upstream);
+        m.allocate(1, 1);
+        assert(C.alloc_count == 1);
+        std::size_t last = C.last_alloc_size;
+        for (int i = 0; i != 100000; ++i)
+        {
+            void* p = m.allocate(24, 8);
+            assert(reinterpret_cast<std::uintptr_t>(p) % 8 == 0);
+            std::memset(p, 0xAB, 24);
+            if (C.last_alloc_size != last)
+            {
+                // Every chunk is at least twice the size of the previous one.
+                assert(C.last_alloc_size >= 2 * last - 64);
+                last = C.last_alloc_size;
+            }
+        }
+        assert(C.alloc_count < 20);
+
+        // A request larger than the next chunk gets a chunk of its own.
+        void* p = m.allocate(last * 4, 64);
+        assert(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+        assert(C.last_alloc_size >= last * 4);
+        assert(C.last_alloc_align >= 64);
+    }
+    assert(C.alive == 0);
+}
+
+void test_containers()
+{
+    char buffer[1024];
+    ex::monotonic_buffer_resource m(buffer, sizeof(buffer));
+    ex::vector<int> v(&m);
+    for (int i = 0; i != 1000; ++i)
+        v.push_back(i);
+    for (int i = 0; i != 1000; ++i)
+        assert(v[i] == i);
+}
+
+int main(int, char**)
+{
+    test_ctors();
+    test_initial_buffer();
+    test_growth();
+    test_containers();
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: c++experimental
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/memory_resource>
+
+// class unsynchronized_pool_resource
+// class synchronized_pool_resource
+
+#include <experimental/memory_resource>
+#include <experimental/list>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include "test_memory_resource.hpp"
+
+namespace ex = std::experimental::pmr;
+
+template <class Pool>
+void test_options()
+{
+    {
+        Pool p;
+        assert(p.upstream_resource() == ex::get_default_resource());
+        ex::pool_options opts = p.options();
+        assert(opts.max_blocks_per_chunk > 0);
+        assert(opts.largest_required_pool_block > 0);
+    }
+    {
+        ex::pool_options opts;
+        opts.max_blocks_per_chunk = 100;
+        opts.largest_required_pool_block = 200;
+        Pool p(opts);
+        // Rounded up to a size the pools use.
+        assert(p.options().max_blocks_per_chunk >= 100);
+        assert(p.options().largest_required_pool_block >= 200);
+        assert(p.options().largest_required_pool_block < 400);
+    }
+    static_assert(!std::is_copy_constructible<Pool>::value, "");
+    static_assert(!std::is_copy_assignable<Pool>::value, "");
+}
+
+template <class Pool>
+void test_allocate()
+{
+    NewDeleteResource upstream;
+    AllocController& C = upstream.getController();
+    {
+        Pool p(&upstream);
+        assert(p.upstream_resource() == &upstream);
+        assert(p.is_equal(p));
+        Pool other(&upstream);
+        assert(!p.is_equal(other));
+
+        // Blocks of one size class come from the same chunk.
+        void* a = p.allocate(24, 8);
+        void* b = p.allocate(30, 8);
+        assert(a != b);
+        assert(reinterpret_cast<std::uintptr_t>(a) % 8 == 0);
+        const int chunks = C.alloc_count;
+        assert(chunks > 0);
+
+        // Freed blocks are reused without asking upstream.
+        p.deallocate(b, 30, 8);
+        void* c = p.allocate(32, 8);
+        assert(c == b);
+        assert(C.alloc_count == chunks);
+
+        // Every request is aligned as asked.  Larger alignments are left to
+        // upstream, which this one doesn't honour.
+        for (std::size_t align = 1; align <= alignof(std::max_align_t); align *= 2)
+            for (std::size_t bytes = 1; bytes <= 256; bytes += 37)
+            {
+                void* q = p.allocate(bytes, align);
+                assert(reinterpret_cast<std::uintptr_t>(q) % align == 0);
+                std::memset(q, 0xAB, bytes);
+            }
+
+        // Requests larger than the largest pool go straight upstream.
+        const std::size_t big = p.options().largest_required_pool_block * 2;
+        const int before = C.alloc_count;
+        void* d = p.allocate(big, 16);
+        assert(C.alloc_count == before + 1);
+        p.deallocate(d, big, 16);
+        assert(C.dealloc_count == 1);
+
+        p.deallocate(a, 24, 8);
+        p.deallocate(c, 32, 8);
+
+        p.release();
+        assert(C.alive == 0);
+        p.allocate(8, 8);
+        assert(C.alive > 0);
+    }
+    // The destructor releases everything.
+    assert(C.alive == 0);
+}
+
+template <class Pool>
+void test_growth()
+{
+    NewDeleteResource upstream;
+    AllocController& C = upstream.getController();
+    Pool p(&upstream);
+    // Chunks grow geometrically, so a million blocks need few of them.
+    for (int i = 0; i != 1000000; ++i)
+        p.allocate(16, 8);
+    assert(C.alloc_count < 40);
+}
+
+void test_containers()
+{
+    ex::unsynchronized_pool_resource p;
+    ex::list<int> l(&p);
+    for (int i = 0; i != 1000; ++i)
+        l.push_back(i);
+    int n = 0;
+    for (int x : l)
+        assert(x == n++);
+    l.clear();
+    assert(l.get_allocator().resource() == &p);
+}
+
+int main(int, char**)
+{
+    test_options<ex::unsynchronized_pool_resource>();
+    test_options<ex::synchronized_pool_resource>();
+    test_allocate<ex::unsynchronized_pool_resource>();
+    test_allocate<ex::synchronized_pool_resource>();
+    test_growth<ex::unsynchronized_pool_resource>();
+    test_containers();
+
+  return 0;
+}
@@ -24,15 +24,24 @@
 
 #include "test_macros.h"
 
+// libc++ built with _LIBCPP_ABI_REGEX_NFA only backtracks for back references,
+// and matches other patterns in linear time.
+#ifdef _LIBCPP_ABI_REGEX_NFA
+#define LINEAR_TIME true
+#else
+#define LINEAR_TIME false
+#endif
+
 int main()
 {
     try {
         std::regex re("a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?aaaaaaaaaaaaaaaaaaaa");
         const char s[] = "aaaaaaaaaaaaaaaaaaaa";
         std::string r = std::regex_replace(s, re, "123-&", std::regex_constants::format_sed);
-        LIBCPP_ASSERT(false);
+        LIBCPP_ASSERT(LINEAR_TIME);
         assert(r == "123-aaaaaaaaaaaaaaaaaaaa");
     } catch (const std::regex_error &e) {
+      LIBCPP_ASSERT(!LINEAR_TIME);
       assert(e.code() == std::regex_constants::error_complexity);
     }
 }
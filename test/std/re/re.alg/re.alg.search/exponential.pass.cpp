@@ -23,6 +23,14 @@
 #include <cassert>
 #include "test_macros.h"
 
+// libc++ built with _LIBCPP_ABI_REGEX_NFA only backtracks for back references,
+// and matches other patterns in linear time.
+#ifdef _LIBCPP_ABI_REGEX_NFA
+#define LINEAR_TIME true
+#else
+#define LINEAR_TIME false
+#endif
+
 int main() {
   for (std::regex_constants::syntax_option_type op :
        {std::regex::ECMAScript, std::regex::extended, std::regex::egrep,
@@ -33,12 +41,23 @@ int main() {
           std::regex(
               "a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?aaaaaaaaaaaaaaaaaaaa",
               op));
-      LIBCPP_ASSERT(false);
+      LIBCPP_ASSERT(LINEAR_TIME);
       assert(b);
     } catch (const std::regex_error &e) {
+      LIBCPP_ASSERT(!LINEAR_TIME);
       assert(e.code() == std::regex_constants::error_complexity);
     }
   }
+  try {
+    bool b = std::regex_search(
+        "aaaaaaaaaaaaaaaaaaaa",
+        std::regex(
+            "(a?)a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?a?aaaaaaaaaaaaaaaaaaaa\\1"));
+    LIBCPP_ASSERT(false);
+    assert(b);
+  } catch (const std::regex_error &e) {
+    assert(e.code() == std::regex_constants::error_complexity);
+  }
   std::string s(100000, 'a');
   for (std::regex_constants::syntax_option_type op :
        {std::regex::ECMAScript, std::regex::extended, std::regex::egrep,
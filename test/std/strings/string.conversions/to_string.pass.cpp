@@ -120,6 +120,9 @@ int main()
     test_unsigned<unsigned>();
     test_unsigned<unsigned long>();
     test_unsigned<unsigned long long>();
+    assert(std::to_string(100000000LL) == "100000000");
+    assert(std::to_string(-123456789012LL) == "-123456789012");
+    assert(std::to_string(9999999999999999ULL) == "9999999999999999");
     test_float<float>();
     test_float<double>();
     test_float<long double>();
@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// XFAIL: with_system_cxx_lib=macosx10.14
+// XFAIL: with_system_cxx_lib=macosx10.13
+// XFAIL: with_system_cxx_lib=macosx10.12
+// XFAIL: with_system_cxx_lib=macosx10.11
+// XFAIL: with_system_cxx_lib=macosx10.10
+// XFAIL: with_system_cxx_lib=macosx10.9
+// XFAIL: with_system_cxx_lib=macosx10.8
+// XFAIL: with_system_cxx_lib=macosx10.7
+
+// <charconv>
+
+// from_chars_result from_chars(const char* first, const char* last,
+//                              float& value,
+//                              chars_format fmt = chars_format::general);
+// from_chars_result from_chars(const char* first, const char* last,
+//                              double& value,
+//                              chars_format fmt = chars_format::general);
+
+#include <charconv>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "test_macros.h"
+
+template <typename T>
+void test(const char* s, T expected, std::size_t length,
+          std::chars_format fmt = std::chars_format::general)
+{
+    T value = 0;
+    std::from_chars_result r =
+        std::from_chars(s, s + std::strlen(s), value, fmt);
+    assert(r.ec == std::errc());
+    assert(r.ptr == s + length);
+    assert(value == expected);
+    assert(std::signbit(value) == std::signbit(expected));
+}
+
+template <typename T>
+void test_error(const char* s, std::errc ec, std::size_t length,
+                std::chars_format fmt = std::chars_format::general)
+{
+    T value = 42;
+    std::from_chars_result r =
+        std::from_chars(s, s + std::strlen(s), value, fmt);
+    assert(r.ec == ec);
+    assert(r.ptr == s + length);
+    assert(value == 42);
+}
+
+template <typename T>
+void test_roundtrip(T value)
+{
+    for (int i = 0; i < 5; ++i)
+    {
+        char buf[400];
+        std::chars_format fmt = static_cast<std::chars_format>(i);
+        std::to_chars_result w =
+            i == 0 ? std::to_chars(buf, buf + sizeof(buf), value)
+                   : std::to_chars(buf, buf + sizeof(buf), value, fmt);
+        assert(w.ec == std::errc());
+        T x;
+        std::from_chars_result r = std::from_chars(
+            buf, w.ptr, x, i == 0 ? std::chars_format::general : fmt);
+        assert(r.ec == std::errc());
+        assert(r.ptr == w.ptr);
+        assert(x == value);
+    }
+}
+
+int main()
+{
+    using std::chars_format;
+    typedef std::numeric_limits<double> dl;
+    typedef std::numeric_limits<float> fl;
+
+    test("0", 0.0, 1);
+    test("-0", -0.0, 2);
+    test("1.5", 1.5, 3);
+    test("-.5x", -0.5, 3);
+    test("1.", 1.0, 2);
+    test("00012.50e-1", 1.25, 11);
+    test("1e", 1.0, 1);
+    test("1e+", 1.0, 1);
+    test("0.1", 0.1, 3);
+    test("1e23", 1e23, 4);
+    test("2.2250738585072014e-308", dl::min(), 23);
+    test("4.9406564584124654e-324", dl::denorm_min(), 23);
+    test("1.7976931348623157e308", dl::max(), 22);
+    test("9007199254740993", 9007199254740992.0, 16);
+    {
+        // More digits than can matter: the trailing 1 still decides that the
+        // value is above the halfway point.
+        char buf[1000];
+        std::memset(buf, '0', sizeof(buf));
+        std::memcpy(buf, "9007199254740993.", 17);
+        buf[sizeof(buf) - 2] = '1';
+        buf[sizeof(buf) - 1] = '\0';
+        test(buf, 9007199254740994.0, sizeof(buf) - 1);
+    }
+    test("0.1", 0.1f, 3);
+    test("16777217", 16777216.0f, 8);
+    test("3.4028235e38", fl::max(), 12);
+    test("INF", dl::infinity(), 3);
+    test("-Infinity", -dl::infinity(), 9);
+    test("infinit", fl::infinity(), 3);
+
+    double nan;
+    const char* s = "nan(abc_123)x";
+    std::from_chars_result r = std::from_chars(s, s + std::strlen(s), nan);
+    assert(r.ec == std::errc() && r.ptr == s + 12 && std::isnan(nan));
+    s = "-nan(";
+    r = std::from_chars(s, s + std::strlen(s), nan);
+    assert(r.ec == std::errc() && r.ptr == s + 4 && std::isnan(nan));
+
+    test("1.5e3", 1.5, 3, chars_format::fixed);
+    test("1.5e3", 1500.0, 5, chars_format::scientific);
+    test("1.8p1", 3.0, 5, chars_format::hex);
+    test("1.8", 1.5, 3, chars_format::hex);
+    test("0x1p3", 0.0, 1, chars_format::hex);
+    test("-a.bp-4", -0x1.56p-1, 7, chars_format::hex);
+    test("1p-1074", dl::denorm_min(), 7, chars_format::hex);
+
+    test_error<double>("", std::errc::invalid_argument, 0);
+    test_error<double>("-", std::errc::invalid_argument, 0);
+    test_error<double>(".", std::errc::invalid_argument, 0);
+    test_error<double>("+1", std::errc::invalid_argument, 0);
+    test_error<double>(" 1", std::errc::invalid_argument, 0);
+    test_error<double>("in", std::errc::invalid_argument, 0);
+    test_error<double>("1.5", std::errc::invalid_argument, 0,
+                       chars_format::scientific);
+    test_error<double>("1e400", std::errc::result_out_of_range, 5);
+    test_error<double>("-1e-400", std::errc::result_out_of_range, 7);
+    test_error<float>("1e39", std::errc::result_out_of_range, 4);
+    test_error<double>("1p99999", std::errc::result_out_of_range, 7,
+                       chars_format::hex);
+
+    test_roundtrip(0.1);
+    test_roundtrip(-1e-300);
+    test_roundtrip(dl::max());
+    test_roundtrip(dl::denorm_min());
+    test_roundtrip(123456789.125);
+    test_roundtrip(0.1f);
+    test_roundtrip(fl::max());
+    test_roundtrip(fl::denorm_min());
+}
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11
+
+// XFAIL: with_system_cxx_lib=macosx10.14
+// XFAIL: with_system_cxx_lib=macosx10.13
+// XFAIL: with_system_cxx_lib=macosx10.12
+// XFAIL: with_system_cxx_lib=macosx10.11
+// XFAIL: with_system_cxx_lib=macosx10.10
+// XFAIL: with_system_cxx_lib=macosx10.9
+// XFAIL: with_system_cxx_lib=macosx10.8
+// XFAIL: with_system_cxx_lib=macosx10.7
+
+// <charconv>
+
+// to_chars_result to_chars(char* first, char* last, float value);
+// to_chars_result to_chars(char* first, char* last, double value);
+// to_chars_result to_chars(char* first, char* last, float value,
+//                          chars_format fmt);
+// to_chars_result to_chars(char* first, char* last, double value,
+//                          chars_format fmt);
+
+#include <charconv>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "test_macros.h"
+
+template <typename T>
+void test(T value, const char* expected)
+{
+    char buf[400];
+    std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), value);
+    assert(r.ec == std::errc());
+    assert(std::size_t(r.ptr - buf) == std::strlen(expected));
+    assert(std::memcmp(buf, expected, r.ptr - buf) == 0);
+
+    // Exactly enough room, and one character short.
+    r = std::to_chars(buf, buf + std::strlen(expected), value);
+    assert(r.ec == std::errc());
+    r = std::to_chars(buf, buf + std::strlen(expected) - 1, value);
+    assert(r.ec == std::errc::value_too_large);
+    assert(r.ptr == buf + std::strlen(expected) - 1);
+}
+
+template <typename T>
+void test(T value, std::chars_format fmt, const char* expected)
+{
+    char buf[400];
+    std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), value, fmt);
+    assert(r.ec == std::errc());
+    assert(std::size_t(r.ptr - buf) == std::strlen(expected));
+    assert(std::memcmp(buf, expected, r.ptr - buf) == 0);
+
+    r = std::to_chars(buf, buf + std::strlen(expected) - 1, value, fmt);
+    assert(r.ec == std::errc::value_too_large);
+}
+
+int main()
+{
+    using std::chars_format;
+    typedef std::numeric_limits<double> dl;
+    typedef std::numeric_limits<float> fl;
+
+    // Shortest round trip, picking the shorter of fixed and scientific.
+    test(0.0, "0");
+    test(-0.0, "-0");
+    test(1.0, "1");
+    test(0.1, "0.1");
+    test(0.3, "0.3");
+    test(1.5e-7, "1.5e-07");
+    test(123456.0, "123456");
+    test(1e5, "1e+05");
+    test(1e23, "1e+23");
+    test(9007199254740993.0, "9007199254740992");
+    test(dl::max(), "1.7976931348623157e+308");
+    test(dl::min(), "2.2250738585072014e-308");
+    test(dl::denorm_min(), "5e-324");
+    test(dl::infinity(), "inf");
+    test(-dl::infinity(), "-inf");
+    test(dl::quiet_NaN(), "nan");
+    test(0.1f, "0.1");
+    test(16777216.0f, "16777216");
+    test(fl::max(), "3.4028235e+38");
+    test(fl::denorm_min(), "1e-45");
+
+    test(0.0, chars_format::scientific, "0e+00");
+    test(1234.5, chars_format::scientific, "1.2345e+03");
+    test(-1e-100, chars_format::scientific, "-1e-100");
+    test(0.1f, chars_format::scientific, "1e-01");
+
+    test(1e5, chars_format::fixed, "100000");
+    test(1234.5, chars_format::fixed, "1234.5");
+    test(0.00012, chars_format::fixed, "0.00012");
+    test(-2.5f, chars_format::fixed, "-2.5");
+
+    test(1e5, chars_format::general, "1e+05");
+    test(123456.0, chars_format::general, "123456");
+    test(0.0001, chars_format::general, "0.0001");
+    test(0.00001, chars_format::general, "1e-05");
+
+    test(1.0, chars_format::hex, "1p+0");
+    test(-1.5, chars_format::hex, "-1.8p+0");
+    test(0.1, chars_format::hex, "1.999999999999ap-4");
+    test(dl::denorm_min(), chars_format::hex, "0.0000000000001p-1022");
+    test(0.0, chars_format::hex, "0p+0");
+    test(1.1f, chars_format::hex, "1.19999ap+0");
+    test(fl::denorm_min(), chars_format::hex, "0.000002p-126");
+}
@@ -24,6 +24,8 @@
 #include <cstdlib>
 #include <cassert>
 
+#include "test_macros.h"
+
 class A
 {
     int data_[10];
@@ -89,4 +91,15 @@ int main()
     assert(f.target<int>() == nullptr);
     }
     assert(A::count == 0);
+#if TEST_STD_VER >= 11
+    {
+    auto l = [](int i) { return i + 1; };
+    const std::function<int(int)> f = l;
+    assert(f.target<decltype(l)>());
+    assert((*f.target<decltype(l)>())(1) == 2);
+    assert(f.target<A>() == nullptr);
+    std::function<int(int)> h = f;
+    assert(h.target<decltype(l)>());
+    }
+#endif
 }